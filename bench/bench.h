@@ -0,0 +1,83 @@
+#pragma once
+
+#ifndef ARX_BENCH_H
+#define ARX_BENCH_H
+
+// Host-side helpers shared by the benchmarks in this directory.
+// Build with e.g. `g++ -std=c++11 -O2 -DUSE_ARX_LIB=1 -I../src bench_frozen_set.cpp`
+
+#include <stdint.h>
+#include <stdio.h>
+#include <chrono>
+
+namespace arx {
+    namespace bench {
+
+        // keep the compiler from optimizing away a computed value
+        template<typename T>
+        inline void do_not_optimize(const T &value) {
+            asm volatile("" : : "r,m"(value) : "memory");
+        }
+
+        inline uint64_t now_ns() {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        // xorshift, so that results don't depend on the libc rand() implementation
+        struct rng {
+            uint32_t state{2463534242UL};
+
+            uint32_t operator()() {
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+                return state;
+            }
+        };
+
+        // runs f(i) for i in [0, iterations) and returns ns per call
+        template<typename F>
+        inline double measure(size_t iterations, F f) {
+            uint64_t start = now_ns();
+            for (size_t i = 0; i < iterations; ++i) f(i);
+            return double(now_ns() - start) / double(iterations);
+        }
+
+        // cost of the two now_ns() calls around a timed section
+        inline double timer_overhead_ns() {
+            static double overhead = -1;
+            if (overhead < 0) {
+                const size_t n = 10000;
+                uint64_t total = 0;
+                for (size_t i = 0; i < n; ++i) {
+                    const uint64_t start = now_ns();
+                    total += now_ns() - start;
+                }
+                overhead = double(total) / double(n);
+            }
+            return overhead;
+        }
+
+        // runs rounds of ops_per_round operations until about budget_ns have been spent in body().
+        // setup() runs untimed before each round, e.g. to refill a container that body() drains.
+        // returns ns per operation
+        template<typename Setup, typename Body>
+        inline double measure_rounds(size_t ops_per_round, Setup setup, Body body, uint64_t budget_ns = 10000000) {
+            uint64_t spent = 0;
+            size_t rounds = 0;
+            while (spent < budget_ns || rounds < 3) {
+                setup();
+                const uint64_t start = now_ns();
+                body();
+                spent += now_ns() - start;
+                ++rounds;
+            }
+            const double per_round = double(spent) / double(rounds) - timer_overhead_ns();
+            return (per_round > 0 ? per_round : 0) / double(ops_per_round);
+        }
+
+    } // namespace bench
+} // namespace arx
+
+#endif //ARX_BENCH_H
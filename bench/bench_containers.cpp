@@ -0,0 +1,450 @@
+// ns/op of the basic operations of every arx container next to its std equivalent,
+// for several N and element types. Prints a table, or JSON with --json (see the Makefile).
+// g++ -std=c++11 -O2 -DUSE_ARX_LIB=1 -I../src bench_containers.cpp -o bench_containers
+
+#include <string.h>
+#include <array>
+#include <deque>
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include "ArxContainer.h"
+#include "InplaceString.h"
+#include "bench.h"
+
+using arx::bench::do_not_optimize;
+using arx::bench::measure_rounds;
+
+// ---- results
+
+struct Result {
+    const char *container;
+    const char *op;
+    const char *type;
+    size_t n;
+    double arx_ns;
+    double std_ns;
+};
+
+static std::vector<Result> results;
+
+static void record(const char *container, const char *op, const char *type, size_t n, double arx_ns, double std_ns) {
+    results.push_back(Result{container, op, type, n, arx_ns, std_ns});
+}
+
+static void print_table() {
+    printf("%-11s %-10s %-9s %5s %12s %12s %8s\n", "container", "op", "type", "N", "arx ns/op", "std ns/op", "arx/std");
+    for (const Result &r : results)
+        printf("%-11s %-10s %-9s %5zu %12.2f %12.2f %8.2f\n",
+               r.container, r.op, r.type, r.n, r.arx_ns, r.std_ns, r.std_ns > 0 ? r.arx_ns / r.std_ns : 0.0);
+}
+
+static void print_json() {
+    printf("[\n");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result &r = results[i];
+        printf("  {\"container\": \"%s\", \"op\": \"%s\", \"type\": \"%s\", \"n\": %zu, "
+               "\"arx_ns_per_op\": %.3f, \"std_ns_per_op\": %.3f}%s\n",
+               r.container, r.op, r.type, r.n, r.arx_ns, r.std_ns, i + 1 < results.size() ? "," : "");
+    }
+    printf("]\n");
+}
+
+// ---- element types
+
+struct Blob {
+    uint32_t words[16];
+
+    bool operator==(const Blob &r) const { return memcmp(words, r.words, sizeof(words)) == 0; }
+
+    bool operator!=(const Blob &r) const { return !(*this == r); }
+
+    bool operator<(const Blob &r) const { return memcmp(words, r.words, sizeof(words)) < 0; }
+};
+
+using String16 = arx::inplace_string<16>;
+
+template<typename T>
+struct element;
+
+template<>
+struct element<uint32_t> {
+    static const char *name() { return "uint32"; }
+
+    static uint32_t make(size_t i) { return static_cast<uint32_t>(i * 2654435761UL); }
+
+    static uint32_t sum(uint32_t v) { return v; }
+};
+
+template<>
+struct element<Blob> {
+    static const char *name() { return "blob64"; }
+
+    static Blob make(size_t i) {
+        Blob b;
+        for (uint32_t &w : b.words) w = static_cast<uint32_t>(i);
+        b.words[0] = static_cast<uint32_t>(i * 2654435761UL);
+        return b;
+    }
+
+    static uint32_t sum(const Blob &b) { return b.words[0]; }
+};
+
+// map / set keys: inplace_string<16> on the arx side, std::string on the std side
+template<>
+struct element<String16> {
+    static const char *name() { return "string16"; }
+
+    static String16 make(size_t i) {
+        char buf[17];
+        snprintf(buf, sizeof(buf), "sensor/%08x", static_cast<unsigned>(i * 2654435761UL));
+        return String16(buf);
+    }
+
+    static uint32_t sum(const String16 &s) { return static_cast<uint32_t>(s.size()); }
+};
+
+template<>
+struct element<std::string> {
+    static std::string make(size_t i) { return element<String16>::make(i).c_str(); }
+
+    static uint32_t sum(const std::string &s) { return static_cast<uint32_t>(s.size()); }
+};
+
+template<typename T>
+struct std_key {
+    using type = T;
+};
+
+template<>
+struct std_key<String16> {
+    using type = std::string;
+};
+
+// ---- vector
+
+template<typename T, size_t N>
+void bench_vector() {
+    using E = element<T>;
+    static arx::stdx::vector<T, N> a;
+    static std::vector<T> s;
+    s.reserve(N);
+    static T values[N];
+    for (size_t i = 0; i < N; ++i) values[i] = E::make(i);
+    auto fill_a = [&]() { a.clear(); for (size_t i = 0; i < N; ++i) a.push_back(values[i]); };
+    auto fill_s = [&]() { s.clear(); for (size_t i = 0; i < N; ++i) s.push_back(values[i]); };
+    auto nothing = []() {};
+    const char *type = E::name();
+    double ta, ts;
+
+    ta = measure_rounds(N, [&]() { a.clear(); }, [&]() { for (size_t i = 0; i < N; ++i) a.push_back(values[i]); });
+    ts = measure_rounds(N, [&]() { s.clear(); }, [&]() { for (size_t i = 0; i < N; ++i) s.push_back(values[i]); });
+    record("vector", "push_back", type, N, ta, ts);
+
+    ta = measure_rounds(N, fill_a, [&]() { for (size_t i = 0; i < N; ++i) a.pop_back(); });
+    ts = measure_rounds(N, fill_s, [&]() { for (size_t i = 0; i < N; ++i) s.pop_back(); });
+    record("vector", "pop_back", type, N, ta, ts);
+
+    fill_a();
+    fill_s();
+    uint32_t sum = 0;
+    ta = measure_rounds(N, nothing, [&]() { for (size_t i = 0; i < N; ++i) sum += E::sum(a[i]); });
+    ts = measure_rounds(N, nothing, [&]() { for (size_t i = 0; i < N; ++i) sum += E::sum(s[i]); });
+    record("vector", "index", type, N, ta, ts);
+
+    ta = measure_rounds(N, nothing, [&]() { for (const T &v : a) sum += E::sum(v); });
+    ts = measure_rounds(N, nothing, [&]() { for (const T &v : s) sum += E::sum(v); });
+    record("vector", "iterate", type, N, ta, ts);
+
+    // linear search for the last element
+    const T &needle = values[N - 1];
+    ta = measure_rounds(N, nothing, [&]() {
+        for (auto it = a.begin(); it != a.end(); ++it) if (*it == needle) { sum += 1; break; }
+    });
+    ts = measure_rounds(N, nothing, [&]() {
+        for (auto it = s.begin(); it != s.end(); ++it) if (*it == needle) { sum += 1; break; }
+    });
+    record("vector", "find", type, N, ta, ts);
+
+    // insert at the front, shifting everything else
+    auto one_a = [&]() { a.clear(); a.push_back(values[0]); };
+    auto one_s = [&]() { s.clear(); s.push_back(values[0]); };
+    ta = measure_rounds(N - 1, one_a, [&]() { for (size_t i = 1; i < N; ++i) a.insert(a.begin(), values[i]); });
+    ts = measure_rounds(N - 1, one_s, [&]() { for (size_t i = 1; i < N; ++i) s.insert(s.begin(), values[i]); });
+    record("vector", "insert", type, N, ta, ts);
+
+    ta = measure_rounds(N, fill_a, [&]() { for (size_t i = 0; i < N; ++i) a.erase(a.begin()); });
+    ts = measure_rounds(N, fill_s, [&]() { for (size_t i = 0; i < N; ++i) s.erase(s.begin()); });
+    record("vector", "erase", type, N, ta, ts);
+
+    do_not_optimize(sum);
+}
+
+// ---- deque
+
+template<typename T, size_t N>
+void bench_deque() {
+    using E = element<T>;
+    static arx::stdx::deque<T, N> a;
+    static std::deque<T> s;
+    static T values[N];
+    for (size_t i = 0; i < N; ++i) values[i] = E::make(i);
+    auto fill_a = [&]() { a.clear(); for (size_t i = 0; i < N; ++i) a.push_back(values[i]); };
+    auto fill_s = [&]() { s.clear(); for (size_t i = 0; i < N; ++i) s.push_back(values[i]); };
+    auto nothing = []() {};
+    const char *type = E::name();
+    double ta, ts;
+
+    ta = measure_rounds(N, [&]() { a.clear(); }, [&]() { for (size_t i = 0; i < N; ++i) a.push_back(values[i]); });
+    ts = measure_rounds(N, [&]() { s.clear(); }, [&]() { for (size_t i = 0; i < N; ++i) s.push_back(values[i]); });
+    record("deque", "push_back", type, N, ta, ts);
+
+    ta = measure_rounds(N, [&]() { a.clear(); }, [&]() { for (size_t i = 0; i < N; ++i) a.push_front(values[i]); });
+    ts = measure_rounds(N, [&]() { s.clear(); }, [&]() { for (size_t i = 0; i < N; ++i) s.push_front(values[i]); });
+    record("deque", "push_front", type, N, ta, ts);
+
+    ta = measure_rounds(N, fill_a, [&]() { for (size_t i = 0; i < N; ++i) a.pop_front(); });
+    ts = measure_rounds(N, fill_s, [&]() { for (size_t i = 0; i < N; ++i) s.pop_front(); });
+    record("deque", "pop_front", type, N, ta, ts);
+
+    fill_a();
+    fill_s();
+    uint32_t sum = 0;
+    ta = measure_rounds(N, nothing, [&]() { for (size_t i = 0; i < N; ++i) sum += E::sum(a[i]); });
+    ts = measure_rounds(N, nothing, [&]() { for (size_t i = 0; i < N; ++i) sum += E::sum(s[i]); });
+    record("deque", "index", type, N, ta, ts);
+
+    ta = measure_rounds(N, nothing, [&]() { for (const T &v : a) sum += E::sum(v); });
+    ts = measure_rounds(N, nothing, [&]() { for (const T &v : s) sum += E::sum(v); });
+    record("deque", "iterate", type, N, ta, ts);
+
+    do_not_optimize(sum);
+}
+
+// ---- array
+
+template<typename T, size_t N>
+void bench_array() {
+    using E = element<T>;
+    static arx::stdx::array<T, N> a;
+    static std::array<T, N> s;
+    static T values[N];
+    for (size_t i = 0; i < N; ++i) values[i] = E::make(i);
+    a.assign(values, values + N);
+    for (size_t i = 0; i < N; ++i) s[i] = values[i];
+    auto nothing = []() {};
+    const char *type = E::name();
+    uint32_t sum = 0;
+    double ta, ts;
+
+    ta = measure_rounds(N, nothing, [&]() { for (size_t i = 0; i < N; ++i) sum += E::sum(a[i]); });
+    ts = measure_rounds(N, nothing, [&]() { for (size_t i = 0; i < N; ++i) sum += E::sum(s[i]); });
+    record("array", "index", type, N, ta, ts);
+
+    ta = measure_rounds(N, nothing, [&]() { for (const T &v : a) sum += E::sum(v); });
+    ts = measure_rounds(N, nothing, [&]() { for (const T &v : s) sum += E::sum(v); });
+    record("array", "iterate", type, N, ta, ts);
+
+    do_not_optimize(sum);
+}
+
+// ---- RingBuffer, against std::deque used as a FIFO
+
+template<typename T, size_t N>
+void bench_ring() {
+    using E = element<T>;
+    static arx::RingBuffer<T, N> a;
+    static std::deque<T> s;
+    static T values[N];
+    for (size_t i = 0; i < N; ++i) values[i] = E::make(i);
+    a.clear();
+    s.clear();
+    for (size_t i = 0; i < N; ++i) {
+        a.push_back(values[i]);
+        s.push_back(values[i]);
+    }
+    auto nothing = []() {};
+    const char *type = E::name();
+    uint32_t sum = 0;
+    double ta, ts;
+
+    // steady state of a full FIFO: one in, one out
+    ta = measure_rounds(N, nothing, [&]() {
+        for (size_t i = 0; i < N; ++i) {
+            sum += E::sum(a.front());
+            a.pop_front();
+            a.push_back(values[i]);
+        }
+    });
+    ts = measure_rounds(N, nothing, [&]() {
+        for (size_t i = 0; i < N; ++i) {
+            sum += E::sum(s.front());
+            s.pop_front();
+            s.push_back(values[i]);
+        }
+    });
+    record("RingBuffer", "push_pop", type, N, ta, ts);
+
+    ta = measure_rounds(N, nothing, [&]() { for (size_t i = 0; i < N; ++i) sum += E::sum(a[i]); });
+    ts = measure_rounds(N, nothing, [&]() { for (size_t i = 0; i < N; ++i) sum += E::sum(s[i]); });
+    record("RingBuffer", "index", type, N, ta, ts);
+
+    do_not_optimize(sum);
+}
+
+// ---- map
+
+template<typename K, size_t N>
+void bench_map() {
+    using SK = typename std_key<K>::type;
+    static arx::stdx::map<K, uint32_t, N> a;
+    static std::map<SK, uint32_t> s;
+    static K keys[N];
+    static SK std_keys[N];
+    for (size_t i = 0; i < N; ++i) {
+        keys[i] = element<K>::make(i);
+        std_keys[i] = element<SK>::make(i);
+    }
+    auto fill_a = [&]() { a.clear(); for (size_t i = 0; i < N; ++i) a.insert(keys[i], i); };
+    auto fill_s = [&]() { s.clear(); for (size_t i = 0; i < N; ++i) s.emplace(std_keys[i], i); };
+    auto nothing = []() {};
+    const char *type = element<K>::name();
+    uint32_t sum = 0;
+    double ta, ts;
+
+    ta = measure_rounds(N, [&]() { a.clear(); }, [&]() { for (size_t i = 0; i < N; ++i) a.insert(keys[i], i); });
+    ts = measure_rounds(N, [&]() { s.clear(); }, [&]() { for (size_t i = 0; i < N; ++i) s.emplace(std_keys[i], i); });
+    record("map", "insert", type, N, ta, ts);
+
+    fill_a();
+    fill_s();
+    ta = measure_rounds(N, nothing, [&]() { for (size_t i = 0; i < N; ++i) sum += a.find(keys[i])->second; });
+    ts = measure_rounds(N, nothing, [&]() { for (size_t i = 0; i < N; ++i) sum += s.find(std_keys[i])->second; });
+    record("map", "find", type, N, ta, ts);
+
+    ta = measure_rounds(N, nothing, [&]() { for (const auto &kv : a) sum += kv.second; });
+    ts = measure_rounds(N, nothing, [&]() { for (const auto &kv : s) sum += kv.second; });
+    record("map", "iterate", type, N, ta, ts);
+
+    ta = measure_rounds(N, fill_a, [&]() { for (size_t i = 0; i < N; ++i) a.erase(keys[i]); });
+    ts = measure_rounds(N, fill_s, [&]() { for (size_t i = 0; i < N; ++i) s.erase(std_keys[i]); });
+    record("map", "erase", type, N, ta, ts);
+
+    do_not_optimize(sum);
+}
+
+// ---- set
+
+template<typename K, size_t N>
+void bench_set() {
+    using SK = typename std_key<K>::type;
+    static arx::stdx::set<K, N> a;
+    static std::set<SK> s;
+    static K keys[N];
+    static SK std_keys[N];
+    for (size_t i = 0; i < N; ++i) {
+        keys[i] = element<K>::make(i);
+        std_keys[i] = element<SK>::make(i);
+    }
+    auto fill_a = [&]() { a.clear(); for (size_t i = 0; i < N; ++i) a.insert(keys[i]); };
+    auto fill_s = [&]() { s.clear(); for (size_t i = 0; i < N; ++i) s.insert(std_keys[i]); };
+    auto nothing = []() {};
+    const char *type = element<K>::name();
+    uint32_t sum = 0;
+    double ta, ts;
+
+    ta = measure_rounds(N, [&]() { a.clear(); }, [&]() { for (size_t i = 0; i < N; ++i) a.insert(keys[i]); });
+    ts = measure_rounds(N, [&]() { s.clear(); }, [&]() { for (size_t i = 0; i < N; ++i) s.insert(std_keys[i]); });
+    record("set", "insert", type, N, ta, ts);
+
+    fill_a();
+    fill_s();
+    ta = measure_rounds(N, nothing, [&]() { for (size_t i = 0; i < N; ++i) sum += a.exist(keys[i]); });
+    ts = measure_rounds(N, nothing, [&]() { for (size_t i = 0; i < N; ++i) sum += s.count(std_keys[i]); });
+    record("set", "find", type, N, ta, ts);
+
+    ta = measure_rounds(N, nothing, [&]() { for (const K &k : a) sum += element<K>::sum(k); });
+    ts = measure_rounds(N, nothing, [&]() { for (const SK &k : s) sum += element<SK>::sum(k); });
+    record("set", "iterate", type, N, ta, ts);
+
+    ta = measure_rounds(N, fill_a, [&]() { for (size_t i = 0; i < N; ++i) a.erase(keys[i]); });
+    ts = measure_rounds(N, fill_s, [&]() { for (size_t i = 0; i < N; ++i) s.erase(std_keys[i]); });
+    record("set", "erase", type, N, ta, ts);
+
+    do_not_optimize(sum);
+}
+
+// ---- function
+
+static const size_t CALLS = 1000;
+
+template<typename F>
+__attribute__((noinline)) int call_all(const F &f) {
+    int acc = 0;
+    for (size_t i = 0; i < CALLS; ++i) acc = f(acc);
+    return acc;
+}
+
+void bench_function() {
+    int sum = 0;
+    int step = 3;
+    int *p = &step;
+    auto nothing = []() {};
+    double ta, ts;
+
+    // a lambda capturing one pointer: stored inline by both
+    ta = measure_rounds(CALLS, nothing, [&]() {
+        for (size_t i = 0; i < CALLS; ++i) {
+            arx::stdx::function<int(int)> f = [p](int x) { return x + *p; };
+            do_not_optimize(f);
+            sum += f(1);
+        }
+    });
+    ts = measure_rounds(CALLS, nothing, [&]() {
+        for (size_t i = 0; i < CALLS; ++i) {
+            std::function<int(int)> f = [p](int x) { return x + *p; };
+            do_not_optimize(f);
+            sum += f(1);
+        }
+    });
+    record("function", "construct", "lambda8", 1, ta, ts);
+
+    arx::stdx::function<int(int)> fa = [p](int x) { return x + *p; };
+    std::function<int(int)> fs = [p](int x) { return x + *p; };
+    ta = measure_rounds(CALLS, nothing, [&]() { sum += call_all(fa); });
+    ts = measure_rounds(CALLS, nothing, [&]() { sum += call_all(fs); });
+    record("function", "call", "lambda8", 1, ta, ts);
+
+    do_not_optimize(sum);
+}
+
+template<size_t N>
+void bench_all_n() {
+    bench_vector<uint32_t, N>();
+    bench_vector<Blob, N>();
+    bench_deque<uint32_t, N>();
+    bench_deque<Blob, N>();
+    bench_array<uint32_t, N>();
+    bench_array<Blob, N>();
+    bench_ring<uint32_t, N>();
+    bench_ring<Blob, N>();
+    bench_map<uint32_t, N>();
+    bench_map<String16, N>();
+    bench_set<uint32_t, N>();
+    bench_set<String16, N>();
+}
+
+int main(int argc, char **argv) {
+    const bool json = argc > 1 && strcmp(argv[1], "--json") == 0;
+    bench_all_n<16>();
+    bench_all_n<64>();
+    bench_all_n<256>();
+    bench_function();
+    if (json)
+        print_json();
+    else
+        print_table();
+    return 0;
+}
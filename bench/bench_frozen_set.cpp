@@ -0,0 +1,40 @@
+// Lookup in arx::stdx::set (sorted array, binary search) vs arx::frozen_set (Eytzinger layout)
+// g++ -std=c++11 -O2 -DUSE_ARX_LIB=1 -I../src bench_frozen_set.cpp -o bench_frozen_set
+
+#include "ArxContainer.h"
+#include "FrozenSet.h"
+#include "bench.h"
+
+static const size_t LOOKUPS = 2000000;
+
+template<size_t N>
+void run() {
+    static arx::stdx::set<uint32_t, N> sorted;
+    static arx::frozen_set<uint32_t, N> frozen;
+
+    // even values only, so that half of the lookups miss; ascending inserts append without shifting
+    sorted.clear();
+    for (size_t i = 0; i < N; ++i) sorted.insert(static_cast<uint32_t>(i * 2));
+    frozen.assign(sorted.begin(), sorted.end());
+
+    static uint32_t keys[LOOKUPS];
+    arx::bench::rng rng;
+    for (size_t i = 0; i < LOOKUPS; ++i) keys[i] = rng() % (N * 2);
+
+    size_t hits_set = 0, hits_frozen = 0;
+    double ns_set = arx::bench::measure(LOOKUPS, [&](size_t i) { hits_set += sorted.exist(keys[i]); });
+    double ns_frozen = arx::bench::measure(LOOKUPS, [&](size_t i) { hits_frozen += frozen.exist(keys[i]); });
+    arx::bench::do_not_optimize(hits_set);
+    arx::bench::do_not_optimize(hits_frozen);
+
+    printf("%8zu elements: set %7.2f ns/lookup, frozen_set %7.2f ns/lookup (%.2fx)%s\n",
+           N, ns_set, ns_frozen, ns_set / ns_frozen, hits_set == hits_frozen ? "" : "  MISMATCH");
+}
+
+int main() {
+    run<1000>();
+    run<10000>();
+    run<100000>();
+    run<1000000>();
+    return 0;
+}
@@ -0,0 +1,68 @@
+// Call overhead of a callback parameter: raw function pointer vs function_ref vs function,
+// with a scalar argument and with a 64-byte struct passed by value
+// g++ -std=c++11 -O2 -DUSE_ARX_LIB=1 -I../src bench_function.cpp -o bench_function
+
+#include "ArxContainer.h"
+#include "Function.h"
+#include "FunctionRef.h"
+#include "bench.h"
+
+static const size_t CALLS = 50000000;
+
+struct Packet {
+    uint32_t words[16];
+};
+
+static int add_one(int x) { return x + 1; }
+
+static int first_word(Packet p) { return static_cast<int>(p.words[0]); }
+
+// noinline, so that every call really goes through the callback type being measured
+template<typename Callback>
+__attribute__((noinline)) int run(Callback cb, size_t n) {
+    int acc = 0;
+    for (size_t i = 0; i < n; ++i) acc = cb(acc);
+    return acc;
+}
+
+template<typename Callback>
+__attribute__((noinline)) int run_packet(Callback cb, size_t n) {
+    Packet p = {};
+    int acc = 0;
+    for (size_t i = 0; i < n; ++i) {
+        p.words[0] = static_cast<uint32_t>(i);
+        acc += cb(p);
+    }
+    return acc;
+}
+
+static void report(const char *name, double ns) {
+    printf("%-28s %6.3f ns/call %8.1f Mcalls/s\n", name, ns, 1000.0 / ns);
+}
+
+int main() {
+    int step = 1;
+    auto lambda = [&step](int x) { return x + step; };
+    auto packet_lambda = [&step](Packet p) { return static_cast<int>(p.words[0]) + step; };
+
+    report("int: function pointer", arx::bench::measure(1, [&](size_t) {
+        arx::bench::do_not_optimize(run<int (*)(int)>(add_one, CALLS));
+    }) / CALLS);
+    report("int: function_ref", arx::bench::measure(1, [&](size_t) {
+        arx::bench::do_not_optimize(run<arx::stdx::function_ref<int(int)>>(lambda, CALLS));
+    }) / CALLS);
+    report("int: function", arx::bench::measure(1, [&](size_t) {
+        arx::bench::do_not_optimize(run<const arx::stdx::function<int(int)> &>(lambda, CALLS));
+    }) / CALLS);
+
+    report("Packet: function pointer", arx::bench::measure(1, [&](size_t) {
+        arx::bench::do_not_optimize(run_packet<int (*)(Packet)>(first_word, CALLS));
+    }) / CALLS);
+    report("Packet: function_ref", arx::bench::measure(1, [&](size_t) {
+        arx::bench::do_not_optimize(run_packet<arx::stdx::function_ref<int(Packet)>>(packet_lambda, CALLS));
+    }) / CALLS);
+    report("Packet: function", arx::bench::measure(1, [&](size_t) {
+        arx::bench::do_not_optimize(run_packet<const arx::stdx::function<int(Packet)> &>(packet_lambda, CALLS));
+    }) / CALLS);
+    return 0;
+}
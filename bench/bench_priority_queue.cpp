@@ -0,0 +1,78 @@
+// Scheduler workload ("hold model"): N pending deadlines, each step pops the earliest one and
+// pushes it back at a random later time. arx::stdx::priority_queue (4-ary and binary) vs a sorted
+// std::vector (the O(N) insert this replaces) vs std::priority_queue.
+// g++ -std=c++11 -O2 -DUSE_ARX_LIB=1 -I../src bench_priority_queue.cpp -o bench_priority_queue
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <vector>
+#include "ArxContainer.h"
+#include "PriorityQueue.h"
+#include "bench.h"
+
+static const size_t STEPS = 1000000;
+static const uint32_t MAX_DELAY = 100000;
+
+template<size_t N, size_t Arity>
+double run_arx(uint64_t &checksum) {
+    static arx::stdx::priority_queue<uint32_t, N, arx::stdx::greater<uint32_t>, Arity> q;
+    q.clear();
+    arx::bench::rng rng;
+    for (size_t i = 0; i < N; ++i) q.push(rng() % MAX_DELAY);
+    return arx::bench::measure(STEPS, [&](size_t) {
+        const uint32_t now = q.top();
+        checksum += now;
+        q.pop();
+        q.push(now + 1 + rng() % MAX_DELAY);
+    });
+}
+
+template<size_t N>
+double run_std(uint64_t &checksum) {
+    std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<uint32_t>> q;
+    arx::bench::rng rng;
+    for (size_t i = 0; i < N; ++i) q.push(rng() % MAX_DELAY);
+    return arx::bench::measure(STEPS, [&](size_t) {
+        const uint32_t now = q.top();
+        checksum += now;
+        q.pop();
+        q.push(now + 1 + rng() % MAX_DELAY);
+    });
+}
+
+// kept in descending order, so the earliest deadline is popped from the back
+template<size_t N>
+double run_sorted(uint64_t &checksum) {
+    std::vector<uint32_t> v;
+    v.reserve(N);
+    arx::bench::rng rng;
+    for (size_t i = 0; i < N; ++i) v.push_back(rng() % MAX_DELAY);
+    std::sort(v.begin(), v.end(), std::greater<uint32_t>());
+    return arx::bench::measure(STEPS, [&](size_t) {
+        const uint32_t now = v.back();
+        checksum += now;
+        v.pop_back();
+        const uint32_t next = now + 1 + rng() % MAX_DELAY;
+        v.insert(std::upper_bound(v.begin(), v.end(), next, std::greater<uint32_t>()), next);
+    });
+}
+
+template<size_t N>
+void run() {
+    uint64_t sum_d4 = 0, sum_d2 = 0, sum_std = 0, sum_sorted = 0;
+    const double d4 = run_arx<N, 4>(sum_d4);
+    const double d2 = run_arx<N, 2>(sum_d2);
+    const double st = run_std<N>(sum_std);
+    const double so = run_sorted<N>(sum_sorted);
+    const bool same = sum_d4 == sum_d2 && sum_d4 == sum_std && sum_d4 == sum_sorted;
+    printf("%6zu pending: 4-ary %6.1f, binary %6.1f, std::priority_queue %6.1f, sorted vector %7.1f ns/op%s\n",
+           N, d4, d2, st, so, same ? "" : "  MISMATCH");
+}
+
+int main() {
+    run<64>();
+    run<1000>();
+    run<10000>();
+    return 0;
+}
@@ -0,0 +1,131 @@
+// thread_pool scaling from 1 worker to all cores, against a pool sharing one mutex-protected queue.
+// "flat": the main thread submits many small jobs; "fork": jobs recursively submit two children,
+// so most work is pushed to and stolen from the worker deques.
+// g++ -std=c++11 -O2 -DUSE_ARX_LIB=1 -I../src bench_thread_pool.cpp -o bench_thread_pool -pthread
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "ArxContainer.h"
+#include "ThreadPool.h"
+#include "bench.h"
+
+static const size_t FLAT_JOBS = 200000;
+static const int FORK_DEPTH = 17;  // 2^17 leaf jobs
+static const uint32_t WORK = 200;  // xorshift rounds per job
+
+static std::atomic<uint32_t> sink{0};
+
+static void work(uint32_t seed) {
+    arx::bench::rng r;
+    r.state += seed;
+    uint32_t x = 0;
+    for (uint32_t i = 0; i < WORK; ++i) x += r();
+    sink.fetch_add(x & 1, std::memory_order_relaxed);
+}
+
+// baseline: every submit and every job goes through one locked queue
+class mutex_pool {
+    std::vector<std::thread> threads_;
+    std::deque<arx::stdx::function<void()>> queue_;
+    std::mutex mutex_;
+    std::condition_variable work_cv_, done_cv_;
+    size_t pending_{0};
+    bool stop_{false};
+
+public:
+    explicit mutex_pool(size_t n) {
+        for (size_t i = 0; i < n; ++i) threads_.emplace_back([this] { run(); });
+    }
+
+    ~mutex_pool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        work_cv_.notify_all();
+        for (auto &t : threads_) t.join();
+    }
+
+    void submit(arx::stdx::function<void()> f) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queue_.push_back(arx::stdx::move(f));
+            ++pending_;
+        }
+        work_cv_.notify_one();
+    }
+
+    void wait_all() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [this] { return pending_ == 0; });
+    }
+
+private:
+    void run() {
+        for (;;) {
+            arx::stdx::function<void()> f;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                work_cv_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+                if (stop_ && queue_.empty()) return;
+                f = arx::stdx::move(queue_.front());
+                queue_.pop_front();
+            }
+            f();
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--pending_ == 0) done_cv_.notify_all();
+        }
+    }
+};
+
+template<typename Pool>
+struct Fork {
+    Pool *pool;
+    int depth;
+
+    void operator()() const {
+        if (depth == 0) {
+            work(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(this)));
+            return;
+        }
+        pool->submit(Fork{pool, depth - 1});
+        pool->submit(Fork{pool, depth - 1});
+    }
+};
+
+template<typename Pool>
+static double flat(size_t workers) {
+    Pool pool(workers);
+    return arx::bench::measure(1, [&](size_t) {
+        for (size_t i = 0; i < FLAT_JOBS; ++i) pool.submit([i] { work(static_cast<uint32_t>(i)); });
+        pool.wait_all();
+    }) / 1e6;
+}
+
+template<typename Pool>
+static double fork(size_t workers) {
+    Pool pool(workers);
+    return arx::bench::measure(1, [&](size_t) {
+        pool.submit(Fork<Pool>{&pool, FORK_DEPTH});
+        pool.wait_all();
+    }) / 1e6;
+}
+
+int main() {
+    const size_t cores = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1;
+    printf("%-8s %14s %14s %14s %14s\n", "workers", "flat pool ms", "flat mutex ms", "fork pool ms", "fork mutex ms");
+    for (size_t n = 1; n <= cores; n *= 2) {
+        const double fp = flat<arx::thread_pool<1024>>(n);
+        const double fm = flat<mutex_pool>(n);
+        const double kp = fork<arx::thread_pool<1024>>(n);
+        const double km = fork<mutex_pool>(n);
+        printf("%-8zu %14.1f %14.1f %14.1f %14.1f\n", n, fp, fm, kp, km);
+        if (n < cores && n * 2 > cores) n = cores / 2;  // always finish with all cores
+    }
+    arx::bench::do_not_optimize(sink.load());
+    return 0;
+}
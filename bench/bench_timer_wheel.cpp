@@ -0,0 +1,83 @@
+// 10K active timers over 60 simulated seconds of 1 ms ticks: timer_wheel vs scanning
+// a vector of (deadline, function) every tick. Expired timers are re-armed with a random
+// delay and a few timers per tick are cancelled and re-armed (debounce / watchdog kick).
+// g++ -std=c++11 -O2 -DUSE_ARX_LIB=1 -I../src bench_timer_wheel.cpp -o bench_timer_wheel
+
+#include <vector>
+#include "ArxContainer.h"
+#include "TimerWheel.h"
+#include "bench.h"
+
+static const size_t TIMERS = 10000;
+static const uint32_t TICKS = 60000;
+static const size_t KICKS_PER_TICK = 8;
+static const uint32_t MAX_DELAY_MS = 5000;
+
+using Wheel = arx::timer_wheel<TIMERS>;
+
+static Wheel wheel;
+static Wheel::timer handles[TIMERS];
+static arx::bench::rng wheel_rng;
+static size_t wheel_fired = 0;
+
+static uint32_t random_delay(arx::bench::rng &r) { return 1 + r() % MAX_DELAY_MS; }
+
+static void arm(size_t id) {
+    handles[id] = wheel.schedule(random_delay(wheel_rng), [id]() {
+        ++wheel_fired;
+        arm(id);
+    });
+}
+
+struct Entry {
+    uint32_t deadline;
+    bool active;
+    arx::stdx::function<void()> callback;
+};
+
+static std::vector<Entry> entries(TIMERS);
+static arx::bench::rng scan_rng;
+static size_t scan_fired = 0;
+static uint32_t scan_now = 0;
+
+static void arm_scan(size_t id) {
+    entries[id].deadline = scan_now + random_delay(scan_rng);
+    entries[id].active = true;
+    entries[id].callback = [id]() {
+        ++scan_fired;
+        arm_scan(id);
+    };
+}
+
+static void report(const char *name, double ns_per_tick, size_t fired) {
+    printf("%-22s %10.1f ns/tick %10zu callbacks\n", name, ns_per_tick, fired);
+}
+
+int main() {
+    for (size_t i = 0; i < TIMERS; ++i) arm(i);
+    const double wheel_ns = arx::bench::measure(TICKS, [&](size_t t) {
+        for (size_t k = 0; k < KICKS_PER_TICK; ++k) {
+            const size_t id = wheel_rng() % TIMERS;
+            if (wheel.cancel(handles[id])) arm(id);
+        }
+        wheel.update(static_cast<uint32_t>(t + 1));
+    });
+    report("timer_wheel", wheel_ns, wheel_fired);
+
+    for (size_t i = 0; i < TIMERS; ++i) arm_scan(i);
+    const double scan_ns = arx::bench::measure(TICKS, [&](size_t t) {
+        for (size_t k = 0; k < KICKS_PER_TICK; ++k) arm_scan(scan_rng() % TIMERS);
+        scan_now = static_cast<uint32_t>(t + 1);
+        for (size_t i = 0; i < entries.size(); ++i) {
+            Entry &e = entries[i];
+            if (e.active && static_cast<int32_t>(scan_now - e.deadline) >= 0) {
+                e.active = false;
+                e.callback();
+            }
+        }
+    });
+    report("vector scan", scan_ns, scan_fired);
+
+    arx::bench::do_not_optimize(wheel.size());
+    return 0;
+}
@@ -0,0 +1,30 @@
+# Sums `nm -C -S -t d` symbol sizes per RingBuffer element type / capacity: the RingBuffer<T, N>
+# members plus exercise<T, N>() from code_size.cpp. The shared ring_core is listed on its own.
+function args(s, start,    depth, i, c) {
+    depth = 1
+    for (i = start; i <= length(s); ++i) {
+        c = substr(s, i, 1)
+        if (c == "<") ++depth
+        else if (c == ">" && --depth == 0) return substr(s, start, i - start)
+    }
+    return ""
+}
+
+$3 ~ /^[tTwW]$/ {
+    size = $2 + 0
+    name = $0
+    sub(/^[^ ]+ [^ ]+ [^ ]+ /, "", name)
+    key = ""
+    if ((p = index(name, "ring_core::")) > 0) key = "ring_core (shared)"
+    else if ((p = index(name, "RingBuffer<")) > 0) key = args(name, p + 11)
+    else if ((p = index(name, "exercise<")) > 0) key = args(name, p + 9)
+    if (key == "") next
+    bytes[key] += size
+    total += size
+}
+
+END {
+    for (k in bytes) printf "%8d  %s\n", bytes[k], k | "sort -k2"
+    close("sort -k2")
+    printf "%8d  total\n", total
+}
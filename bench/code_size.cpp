@@ -0,0 +1,48 @@
+// Code size of RingBuffer instantiations: each deque type below gets push / pop / insert / erase /
+// linearize, built once with the shared type-erased core and once with the typed loops
+// (ARX_RINGBUFFER_SHARED_CORE=0). `make size` prints the bytes of code per instantiation.
+// g++ -std=c++11 -Os -DUSE_ARX_LIB=1 -I../src code_size.cpp -o code_size
+
+#include <stdint.h>
+#include <stdio.h>
+#include "ArxContainer.h"
+
+struct Sample {
+    uint32_t time;
+    int16_t value[4];
+};
+
+static volatile int input = 3;
+
+template<typename T, size_t N>
+__attribute__((noinline)) int exercise(arx::stdx::deque<T, N> &d) {
+    T v[3] = {T(), T(), T()};
+    for (int i = 0; i < input * 4; ++i) d.push_back(v[i % 3]);
+    d.push_front(v[0]);
+    d.insert(d.begin() + input, v, v + 3);
+    d.insert(d.begin() + 1, v[1]);
+    d.erase(d.begin() + input);
+    d.pop_front();
+    d.pop_back();
+    return static_cast<int>(d.linearize().size());
+}
+
+template<typename T, size_t N>
+int run() {
+    static arx::stdx::deque<T, N> d;
+    return exercise(d);
+}
+
+int main() {
+    int sum = 0;
+    sum += run<uint8_t, 64>();
+    sum += run<uint16_t, 32>();
+    sum += run<int, 16>();
+    sum += run<float, 10>();
+    sum += run<uint32_t, 100>();
+    sum += run<Sample, 8>();
+    sum += run<arx::stdx::pair<int, int>, 16>();
+    sum += run<const char *, 12>();
+    printf("%d\n", sum);
+    return 0;
+}
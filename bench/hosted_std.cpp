@@ -0,0 +1,38 @@
+// Compile check of the headers on a host with the standard library and without USE_ARX_LIB:
+// less / greater / equal_to / hash must stay the std ones, so `using namespace std` code is
+// not made ambiguous. Built by `make hosted` for C++11, C++14 and C++17.
+
+#include <LruCache.h>
+#include <FrozenSet.h>
+#include <InplaceString.h>
+#include <StringView.h>
+#include <PriorityQueue.h>
+#include <Algorithm.h>
+#include <functional>
+#include <string>
+
+using namespace std;
+
+int main() {
+    less<int> lt;
+    greater<int> gt;
+    equal_to<int> eq;
+    hash<int> h;
+    hash<string> hs;
+
+    arx::lru_cache<int, int, 4> cache;
+    cache.put(1, 2);
+    const int sorted[] = {1, 2, 3};
+    arx::frozen_set<int, 4> frozen(sorted, sorted + 3);
+    arx::stdx::priority_queue<int, 4, greater<int>> queue;
+    queue.push(3);
+    int values[] = {3, 1, 2};
+    arx::stdx::sort(values, values + 3, gt);
+    const bool found = arx::stdx::lower_bound(values, values + 3, 2, gt) != values + 3;
+
+    const arx::inplace_string<8> key("pump");
+    const size_t keyed = hash<arx::inplace_string<8>>()(key) ^ hash<arx::stdx::string_view>()("pump");
+
+    return lt(1, 2) + gt(1, 2) + eq(1, 1) + static_cast<int>(h(3) ^ hs("x") ^ keyed) +
+           frozen.exist(2) + queue.top() + found;
+}
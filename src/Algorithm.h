@@ -0,0 +1,578 @@
+#pragma once
+
+#ifndef ARX_ALGORITHM_H
+#define ARX_ALGORITHM_H
+
+// bits per radix_sort pass: 256 counters by default, 16 on AVR to keep them off the small stack
+#ifndef ARX_RADIX_SORT_BITS
+    #ifdef __AVR__
+        #define ARX_RADIX_SORT_BITS 4
+    #else
+        #define ARX_RADIX_SORT_BITS 8
+    #endif
+#endif  // ARX_RADIX_SORT_BITS
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "TypeTraits.h"
+#include "Functional.h"
+#include "Move.h"
+#include "Pair.h"
+#include "Span.h"
+#include "RingBuffer.h"
+
+namespace arx {
+    namespace stdx {
+
+        namespace detail {
+            // a < b between the value searched for and the elements, as the std defaults do
+            // (less<> itself is only in C++14 when it comes from the standard library)
+            struct value_less {
+                template<typename A, typename B>
+                bool operator()(const A &a, const B &b) const { return a < b; }
+            };
+
+            template<typename It>
+            struct iter_value {
+                using type = typename remove_cvref<decltype(*declval<It &>())>::type;
+            };
+
+            // no type for non-containers, so that the container overloads drop out for iterators
+            template<typename C, typename = void>
+            struct container_value {};
+
+            template<typename C>
+            struct container_value<C, decltype((void) declval<C &>().begin())> {
+                using type = typename remove_cvref<decltype(*declval<C &>().begin())>::type;
+            };
+
+            template<typename T, size_t M>
+            struct container_value<T[M], void> {
+                using type = T;
+            };
+
+            // rings (vector, deque, array): their elements as two spans, see RingBuffer::spans()
+            template<typename C, typename = void>
+            struct has_spans {
+                static const bool value = false;
+            };
+
+            template<typename C>
+            struct has_spans<C, decltype((void) declval<C &>().spans())> {
+                static const bool value = true;
+            };
+
+            template<typename C>
+            struct is_c_array {
+                static const bool value = false;
+            };
+
+            template<typename T, size_t M>
+            struct is_c_array<T[M]> {
+                static const bool value = true;
+            };
+
+            // containers that can be viewed as one writable span: rings (after linearize())
+            // and contiguous containers with data() / size()
+            template<typename C, typename = void>
+            struct is_sortable {
+                static const bool value = false;
+            };
+
+            template<typename C>
+            struct is_sortable<C, typename enable_if<sizeof(typename container_value<C>::type) != 0>::type> {
+                using T = typename container_value<C>::type;
+                static const bool value = is_linearizable_to<C, T>::value || is_contiguous_of<C, T>::value ||
+                                          is_c_array<C>::value;
+            };
+
+            // containers whose elements can be read as (at most) two contiguous segments
+            template<typename C, typename = void>
+            struct is_segmented {
+                static const bool value = false;
+            };
+
+            template<typename C>
+            struct is_segmented<C, typename enable_if<sizeof(typename container_value<C>::type) != 0>::type> {
+                using T = typename container_value<C>::type;
+                static const bool value = has_spans<C>::value || is_contiguous_of<const C, const T>::value ||
+                                          is_c_array<C>::value;
+            };
+
+            template<typename C>
+            using span_of = span<typename container_value<C>::type>;
+
+            template<typename C>
+            using const_span_of = span<const typename container_value<C>::type>;
+
+            // a ring is read where it lies, without linearize()
+            template<typename C>
+            inline typename enable_if<has_spans<C>::value, pair<const_span_of<C>, const_span_of<C>>>::type
+            segments(C &c) {
+                auto parts = c.spans();
+                return {const_span_of<C>(parts.first), const_span_of<C>(parts.second)};
+            }
+
+            template<typename C>
+            inline typename enable_if<!has_spans<C>::value, pair<const_span_of<C>, const_span_of<C>>>::type
+            segments(C &c) {
+                return {const_span_of<C>(c), const_span_of<C>()};
+            }
+
+            template<typename It>
+            inline void iter_swap(It a, It b) {
+                typename iter_value<It>::type tmp = stdx::move(*a);
+                *a = stdx::move(*b);
+                *b = stdx::move(tmp);
+            }
+
+            template<typename It>
+            inline void reverse(It first, It last) {
+                while (first != last && first != --last) {
+                    detail::iter_swap(first, last);
+                    ++first;
+                }
+            }
+
+            // [first, middle) and [middle, last) swap places, returns the new position of *first
+            template<typename It>
+            inline It rotate(It first, It middle, It last) {
+                detail::reverse(first, middle);
+                detail::reverse(middle, last);
+                detail::reverse(first, last);
+                return first + (last - middle);
+            }
+
+            template<typename It, typename Compare>
+            inline void insertion_sort(It first, It last, Compare &comp) {
+                if (first == last) return;
+                for (It i = first + 1; i != last; ++i) {
+                    typename iter_value<It>::type v = stdx::move(*i);
+                    It j = i;
+                    for (; j != first && comp(v, *(j - 1)); --j) *j = stdx::move(*(j - 1));
+                    *j = stdx::move(v);
+                }
+            }
+
+            template<typename It, typename Diff, typename Compare>
+            inline void sift_down(It first, Diff i, Diff n, Compare &comp) {
+                for (Diff child = 2 * i + 1; child < n; i = child, child = 2 * i + 1) {
+                    if (child + 1 < n && comp(*(first + child), *(first + (child + 1)))) ++child;
+                    if (!comp(*(first + i), *(first + child))) return;
+                    detail::iter_swap(first + i, first + child);
+                }
+            }
+
+            template<typename It, typename Compare>
+            inline void heap_sort(It first, It last, Compare &comp) {
+                const auto n = last - first;
+                for (auto i = n / 2; i > 0; --i) detail::sift_down(first, i - 1, n, comp);
+                for (auto end = n; end > 1; --end) {
+                    detail::iter_swap(first, first + (end - 1));
+                    detail::sift_down(first, decltype(n)(0), end - 1, comp);
+                }
+            }
+
+            template<typename It, typename Compare>
+            inline void move_median_to_first(It result, It a, It b, It c, Compare &comp) {
+                if (comp(*a, *b)) {
+                    if (comp(*b, *c)) detail::iter_swap(result, b);
+                    else if (comp(*a, *c)) detail::iter_swap(result, c);
+                    else detail::iter_swap(result, a);
+                } else if (comp(*a, *c)) {
+                    detail::iter_swap(result, a);
+                } else if (comp(*b, *c)) {
+                    detail::iter_swap(result, c);
+                } else {
+                    detail::iter_swap(result, b);
+                }
+            }
+
+            // median of three as the pivot in *first, then Hoare partition of the rest; the median
+            // guarantees an element on each side, so the scans need no bounds checks
+            template<typename It, typename Compare>
+            inline It partition_pivot(It first, It last, Compare &comp) {
+                detail::move_median_to_first(first, first + 1, first + (last - first) / 2, last - 1, comp);
+                It lo = first + 1;
+                It hi = last;
+                while (true) {
+                    while (comp(*lo, *first)) ++lo;
+                    --hi;
+                    while (comp(*first, *hi)) --hi;
+                    if (!(lo < hi)) return lo;
+                    detail::iter_swap(lo, hi);
+                    ++lo;
+                }
+            }
+
+            // partitions below this size are left to one final insertion sort
+            static const int SORT_THRESHOLD = 16;
+
+            template<typename It, typename Compare>
+            inline void introsort_loop(It first, It last, int depth, Compare &comp) {
+                while (last - first > SORT_THRESHOLD) {
+                    if (depth == 0) {
+                        detail::heap_sort(first, last, comp);
+                        return;
+                    }
+                    --depth;
+                    It cut = detail::partition_pivot(first, last, comp);
+                    // recurse into the smaller part and loop on the larger one: O(log n) stack
+                    if (cut - first < last - cut) {
+                        detail::introsort_loop(first, cut, depth, comp);
+                        first = cut;
+                    } else {
+                        detail::introsort_loop(cut, last, depth, comp);
+                        last = cut;
+                    }
+                }
+            }
+
+            template<typename Diff>
+            inline int depth_limit(Diff n) {
+                int depth = 0;
+                for (; n > 1; n /= 2) depth += 2;
+                return depth;
+            }
+        } // namespace detail
+
+        template<typename It, typename T, typename Compare>
+        inline It lower_bound(It first, It last, const T &value, Compare comp) {
+            auto n = last - first;
+            while (n > 0) {
+                const auto half = n / 2;
+                It mid = first + half;
+                if (comp(*mid, value)) {
+                    first = mid + 1;
+                    n -= half + 1;
+                } else {
+                    n = half;
+                }
+            }
+            return first;
+        }
+
+        template<typename It, typename T>
+        inline It lower_bound(It first, It last, const T &value) {
+            return stdx::lower_bound(first, last, value, detail::value_less());
+        }
+
+        template<typename It, typename T, typename Compare>
+        inline It upper_bound(It first, It last, const T &value, Compare comp) {
+            auto n = last - first;
+            while (n > 0) {
+                const auto half = n / 2;
+                It mid = first + half;
+                if (!comp(value, *mid)) {
+                    first = mid + 1;
+                    n -= half + 1;
+                } else {
+                    n = half;
+                }
+            }
+            return first;
+        }
+
+        template<typename It, typename T>
+        inline It upper_bound(It first, It last, const T &value) {
+            return stdx::upper_bound(first, last, value, detail::value_less());
+        }
+
+        namespace detail {
+            // merges sorted [first, middle) and [middle, last) in place with rotations, no buffer
+            template<typename It, typename Diff, typename Compare>
+            inline void merge_in_place(It first, It middle, It last, Diff len1, Diff len2, Compare &comp) {
+                while (len1 != 0 && len2 != 0) {
+                    if (len1 + len2 == 2) {
+                        if (comp(*middle, *first)) detail::iter_swap(first, middle);
+                        return;
+                    }
+                    It first_cut = first;
+                    It second_cut = middle;
+                    Diff len11 = 0;
+                    Diff len22 = 0;
+                    if (len1 > len2) {
+                        len11 = len1 / 2;
+                        first_cut = first + len11;
+                        second_cut = stdx::lower_bound(middle, last, *first_cut, comp);
+                        len22 = second_cut - middle;
+                    } else {
+                        len22 = len2 / 2;
+                        second_cut = middle + len22;
+                        first_cut = stdx::upper_bound(first, middle, *second_cut, comp);
+                        len11 = first_cut - first;
+                    }
+                    It new_middle = detail::rotate(first_cut, middle, second_cut);
+                    detail::merge_in_place(first, first_cut, new_middle, len11, len22, comp);
+                    // the second half in the loop
+                    first = new_middle;
+                    middle = second_cut;
+                    len1 -= len11;
+                    len2 -= len22;
+                }
+            }
+        } // namespace detail
+
+        // introsort: quicksort with a median-of-three pivot, heap sort if the recursion gets too
+        // deep (O(n log n) worst case), and insertion sort for the small partitions
+        template<typename It, typename Compare>
+        inline void sort(It first, It last, Compare comp) {
+            if (last - first < 2) return;
+            detail::introsort_loop(first, last, detail::depth_limit(last - first), comp);
+            detail::insertion_sort(first, last, comp);
+        }
+
+        template<typename It>
+        inline void sort(It first, It last) {
+            less<typename detail::iter_value<It>::type> comp;
+            stdx::sort(first, last, comp);
+        }
+
+        // insertion-sorted runs merged in place: stable and without a buffer, O(n log^2 n)
+        template<typename It, typename Compare>
+        inline void stable_sort(It first, It last, Compare comp) {
+            const auto n = last - first;
+            using Diff = typename remove_cv<decltype(n)>::type;
+            const Diff run = detail::SORT_THRESHOLD;
+            for (Diff i = 0; i < n; i += run)
+                detail::insertion_sort(first + i, first + (n - i < run ? n : i + run), comp);
+            for (Diff width = run; width < n; width *= 2) {
+                for (Diff i = 0; i + width < n; i += 2 * width) {
+                    const Diff len2 = n - (i + width) < width ? n - (i + width) : width;
+                    detail::merge_in_place(first + i, first + (i + width), first + (i + width + len2), width, len2, comp);
+                }
+            }
+        }
+
+        template<typename It>
+        inline void stable_sort(It first, It last) {
+            less<typename detail::iter_value<It>::type> comp;
+            stdx::stable_sort(first, last, comp);
+        }
+
+        // quickselect: *nth becomes the element a full sort would put there, with no larger
+        // element before it and no smaller one after it
+        template<typename It, typename Compare>
+        inline void nth_element(It first, It nth, It last, Compare comp) {
+            if (first == last || nth == last) return;
+            int depth = detail::depth_limit(last - first);
+            while (last - first > 3) {
+                if (depth-- == 0) {
+                    detail::heap_sort(first, last, comp);
+                    return;
+                }
+                It cut = detail::partition_pivot(first, last, comp);
+                if (cut <= nth) first = cut;
+                else last = cut;
+            }
+            detail::insertion_sort(first, last, comp);
+        }
+
+        template<typename It>
+        inline void nth_element(It first, It nth, It last) {
+            less<typename detail::iter_value<It>::type> comp;
+            stdx::nth_element(first, nth, last, comp);
+        }
+
+        template<typename It, typename T>
+        inline It find(It first, It last, const T &value) {
+            for (; first != last; ++first)
+                if (*first == value) return first;
+            return last;
+        }
+
+        namespace detail {
+            template<bool Bytes>
+            struct find_in {
+                template<typename T, typename V>
+                static T *range(T *first, T *last, const V &value) {
+                    for (; first != last; ++first)
+                        if (*first == value) return first;
+                    return last;
+                }
+            };
+
+            // bytes are searched with memchr
+            template<>
+            struct find_in<true> {
+                template<typename T, typename V>
+                static T *range(T *first, T *last, const V &value) {
+                    const T v = static_cast<T>(value);
+                    if (!(v == value) || first == last) return last;
+                    const void *p = memchr(first, static_cast<unsigned char>(v), static_cast<size_t>(last - first));
+                    return p ? first + (static_cast<const unsigned char *>(p) - reinterpret_cast<const unsigned char *>(first)) : last;
+                }
+            };
+        } // namespace detail
+
+        template<typename T, typename V>
+        inline T *find(T *first, T *last, const V &value) {
+            using U = typename remove_cv<T>::type;
+            return detail::find_in<sizeof(U) == 1 && is_integral<U>::value>::range(first, last, value);
+        }
+
+        // Containers: vector / deque / array (rings), C arrays, static_array, std::vector, ...
+        // sort, stable_sort and nth_element first make a ring contiguous with linearize()
+        // (which invalidates its iterators); find and lower_bound read it in its two segments.
+
+        template<typename C, typename Compare, typename = typename enable_if<detail::is_sortable<C>::value>::type>
+        inline void sort(C &c, Compare comp) {
+            detail::span_of<C> s(c);
+            stdx::sort(s.begin(), s.end(), comp);
+        }
+
+        template<typename C, typename = typename enable_if<detail::is_sortable<C>::value>::type>
+        inline void sort(C &c) {
+            detail::span_of<C> s(c);
+            stdx::sort(s.begin(), s.end());
+        }
+
+        template<typename C, typename Compare, typename = typename enable_if<detail::is_sortable<C>::value>::type>
+        inline void stable_sort(C &c, Compare comp) {
+            detail::span_of<C> s(c);
+            stdx::stable_sort(s.begin(), s.end(), comp);
+        }
+
+        template<typename C, typename = typename enable_if<detail::is_sortable<C>::value>::type>
+        inline void stable_sort(C &c) {
+            detail::span_of<C> s(c);
+            stdx::stable_sort(s.begin(), s.end());
+        }
+
+        // the n-th smallest element of c, which is partially reordered
+        template<typename C, typename Compare, typename = typename enable_if<detail::is_sortable<C>::value>::type>
+        inline typename detail::container_value<C>::type &nth_element(C &c, size_t n, Compare comp) {
+            detail::span_of<C> s(c);
+            stdx::nth_element(s.begin(), s.begin() + n, s.end(), comp);
+            return s[n];
+        }
+
+        template<typename C, typename = typename enable_if<detail::is_sortable<C>::value>::type>
+        inline typename detail::container_value<C>::type &nth_element(C &c, size_t n) {
+            detail::span_of<C> s(c);
+            stdx::nth_element(s.begin(), s.begin() + n, s.end());
+            return s[n];
+        }
+
+        template<typename C, typename T, typename = typename enable_if<detail::is_segmented<C>::value>::type>
+        inline auto find(C &c, const T &value) -> decltype(c.begin()) {
+            auto parts = detail::segments(c);
+            auto p = stdx::find(parts.first.begin(), parts.first.end(), value);
+            if (p != parts.first.end()) return c.begin() + (p - parts.first.begin());
+            p = stdx::find(parts.second.begin(), parts.second.end(), value);
+            if (p != parts.second.end()) return c.begin() + (parts.first.size() + (p - parts.second.begin()));
+            return c.end();
+        }
+
+        // c must be sorted by comp
+        template<typename C, typename T, typename Compare, typename = typename enable_if<detail::is_segmented<C>::value>::type>
+        inline auto lower_bound(C &c, const T &value, Compare comp) -> decltype(c.begin()) {
+            auto parts = detail::segments(c);
+            // the answer is in the second segment only if everything in the first is smaller
+            if (parts.second.empty() || (!parts.first.empty() && !comp(parts.first.back(), value))) {
+                auto p = stdx::lower_bound(parts.first.begin(), parts.first.end(), value, comp);
+                return c.begin() + (p - parts.first.begin());
+            }
+            auto p = stdx::lower_bound(parts.second.begin(), parts.second.end(), value, comp);
+            return c.begin() + (parts.first.size() + (p - parts.second.begin()));
+        }
+
+        template<typename C, typename T, typename = typename enable_if<detail::is_segmented<C>::value>::type>
+        inline auto lower_bound(C &c, const T &value) -> decltype(c.begin()) {
+            return stdx::lower_bound(c, value, detail::value_less());
+        }
+
+        namespace detail {
+            template<size_t Bytes>
+            struct radix_unsigned;
+
+            template<>
+            struct radix_unsigned<1> {
+                using type = uint8_t;
+            };
+
+            template<>
+            struct radix_unsigned<2> {
+                using type = uint16_t;
+            };
+
+            template<>
+            struct radix_unsigned<4> {
+                using type = uint32_t;
+            };
+
+            template<>
+            struct radix_unsigned<8> {
+                using type = uint64_t;
+            };
+
+            struct radix_identity {
+                template<typename T>
+                const T &operator()(const T &v) const { return v; }
+            };
+
+            // the key as an unsigned number in the same order: signed keys get their sign bit flipped
+            template<typename K>
+            inline typename radix_unsigned<sizeof(K)>::type radix_bits(K key) {
+                using U = typename radix_unsigned<sizeof(K)>::type;
+                static_assert(is_integral<K>::value, "radix_sort needs integer keys");
+                const bool is_signed = K(-1) < K(0);
+                return static_cast<U>(static_cast<U>(key) ^ (is_signed ? U(U(1) << (sizeof(K) * 8 - 1)) : U(0)));
+            }
+        } // namespace detail
+
+        // LSD radix sort of [first, last) by an integer key(element), stable, O(n * sizeof(key)).
+        // buffer must hold last - first elements. Passes where all keys share the digit are skipped
+        template<typename T, typename Key>
+        inline void radix_sort(T *first, T *last, T *buffer, Key key) {
+            const size_t n = static_cast<size_t>(last - first);
+            if (n < 2) return;
+            using K = typename remove_cvref<decltype(key(*first))>::type;
+            static const unsigned BITS = ARX_RADIX_SORT_BITS;
+            static const size_t RADIX = size_t(1) << BITS;
+            T *src = first;
+            T *dst = buffer;
+            for (unsigned shift = 0; shift < sizeof(K) * 8; shift += BITS) {
+                size_t count[RADIX] = {};
+                for (size_t i = 0; i < n; ++i) ++count[(detail::radix_bits<K>(key(src[i])) >> shift) & (RADIX - 1)];
+                if (count[(detail::radix_bits<K>(key(src[0])) >> shift) & (RADIX - 1)] == n) continue;
+                size_t sum = 0;
+                for (size_t d = 0; d < RADIX; ++d) {
+                    const size_t c = count[d];
+                    count[d] = sum;
+                    sum += c;
+                }
+                for (size_t i = 0; i < n; ++i)
+                    dst[count[(detail::radix_bits<K>(key(src[i])) >> shift) & (RADIX - 1)]++] = stdx::move(src[i]);
+                T *tmp = src;
+                src = dst;
+                dst = tmp;
+            }
+            if (src != first)
+                for (size_t i = 0; i < n; ++i) first[i] = stdx::move(src[i]);
+        }
+
+        template<typename T>
+        inline void radix_sort(T *first, T *last, T *buffer) {
+            stdx::radix_sort(first, last, buffer, detail::radix_identity());
+        }
+
+        // rings with a fixed N use a buffer of N elements on the stack
+        template<typename T, size_t N, typename Key>
+        inline void radix_sort(RingBuffer<T, N> &c, Key key) {
+            static_assert(N != dynamic_size, "pass a buffer: radix_sort(first, last, buffer)");
+            T buffer[N];
+            span<T> s = c.linearize();
+            stdx::radix_sort(s.begin(), s.end(), buffer, key);
+        }
+
+        template<typename T, size_t N>
+        inline void radix_sort(RingBuffer<T, N> &c) {
+            stdx::radix_sort(c, detail::radix_identity());
+        }
+
+    } // namespace stdx
+} // namespace arx
+
+#endif //ARX_ALGORITHM_H
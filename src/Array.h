@@ -26,10 +26,10 @@ namespace arx {
             }
 
             // move
-            array(array &&r) : RingBuffer<T, N>(r) {}
+            array(array &&r) : RingBuffer<T, N>(stdx::move(r)) {}
 
             array &operator=(array &&r) {
-                RingBuffer<T, N>::operator=(r);
+                RingBuffer<T, N>::operator=(stdx::move(r));
                 return *this;
             }
 
@@ -53,15 +53,18 @@ namespace std {
 #include <set>
 #include <functional>
 #include <deque>
+#include <queue>
 
 #else
 
+#include "Functional.h"
 #include "Vector.h"
 #include "Array.h"
 #include "Map.h"
 #include "Set.h"
 #include "Function.h"
 #include "Deque.h"
+#include "PriorityQueue.h"
 
 #endif
 
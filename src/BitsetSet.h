@@ -0,0 +1,205 @@
+#pragma once
+
+#ifndef ARX_BITSET_SET_H
+#define ARX_BITSET_SET_H
+
+#include <stdint.h>
+#include "ArxContainer.h"
+
+namespace arx {
+
+    namespace detail {
+        inline uint8_t ctz32(uint32_t w) {
+            return sizeof(unsigned int) >= 4 ? __builtin_ctz(w) : __builtin_ctzl(w);
+        }
+
+        inline uint8_t popcount32(uint32_t w) {
+            return sizeof(unsigned int) >= 4 ? __builtin_popcount(w) : __builtin_popcountl(w);
+        }
+
+        template<size_t Domain, bool Byte = (Domain <= 256), bool Short = (Domain <= 65536)>
+        struct bitset_value {
+            typedef size_t type;
+        };
+
+        template<size_t Domain, bool Short>
+        struct bitset_value<Domain, true, Short> {
+            typedef uint8_t type;
+        };
+
+        template<size_t Domain>
+        struct bitset_value<Domain, false, true> {
+            typedef uint16_t type;
+        };
+    } // namespace detail
+
+    // Set of values in [0, Domain) backed by a fixed bit array.
+    // insert/erase/exist are O(1), iteration skips empty bits with count-trailing-zeros,
+    // and union/intersection work a 32-bit word at a time.
+    // T can be any integral or enum type convertible to/from size_t.
+    template<size_t Domain, typename T = typename detail::bitset_value<Domain>::type>
+    class bitset_set {
+        static_assert(Domain > 0, "bitset_set domain must not be empty");
+
+        static const size_t WORDS = (Domain + 31) / 32;
+
+        uint32_t words_[WORDS];
+
+    public:
+        class const_iterator {
+            friend bitset_set;
+
+            const uint32_t *words{nullptr};
+            size_t pos{Domain};
+
+            const_iterator(const uint32_t *words, size_t pos) : words(words), pos(pos) {}
+
+            void advance() {
+                size_t w = pos / 32;
+                if (w >= WORDS) {
+                    pos = Domain;
+                    return;
+                }
+                uint32_t bits = words[w] & (~uint32_t(0) << (pos % 32));
+                while (bits == 0) {
+                    if (++w >= WORDS) {
+                        pos = Domain;
+                        return;
+                    }
+                    bits = words[w];
+                }
+                pos = w * 32 + detail::ctz32(bits);
+            }
+
+        public:
+            const_iterator() {}
+
+            T operator*() const { return static_cast<T>(pos); }
+
+            const_iterator &operator++() {
+                ++pos;
+                advance();
+                return *this;
+            }
+
+            const_iterator operator++(int) {
+                const_iterator it = *this;
+                ++(*this);
+                return it;
+            }
+
+            bool operator==(const const_iterator &rhs) const { return pos == rhs.pos; }
+
+            bool operator!=(const const_iterator &rhs) const { return pos != rhs.pos; }
+        };
+
+        using iterator = const_iterator;
+
+        bitset_set() { clear(); }
+
+        bitset_set(std::initializer_list<T> lst) {
+            clear();
+            for (const auto &item: lst) insert(item);
+        }
+
+        bool insert(const T &v) {
+            const size_t i = static_cast<size_t>(v);
+            if (i >= Domain || test(i)) return false;
+            words_[i / 32] |= bit(i);
+            return true;
+        }
+
+        bool erase(const T &v) {
+            const size_t i = static_cast<size_t>(v);
+            if (i >= Domain || !test(i)) return false;
+            words_[i / 32] &= ~bit(i);
+            return true;
+        }
+
+        bool exist(const T &v) const {
+            const size_t i = static_cast<size_t>(v);
+            return i < Domain && test(i);
+        }
+
+        size_t count(const T &v) const { return exist(v) ? 1 : 0; }
+
+        void clear() {
+            for (size_t i = 0; i < WORDS; ++i) words_[i] = 0;
+        }
+
+        size_t size() const {
+            size_t n = 0;
+            for (size_t i = 0; i < WORDS; ++i) n += detail::popcount32(words_[i]);
+            return n;
+        }
+
+        bool empty() const {
+            for (size_t i = 0; i < WORDS; ++i)
+                if (words_[i]) return false;
+            return true;
+        }
+
+        size_t capacity() const { return Domain; }
+
+        const_iterator begin() const {
+            const_iterator it(words_, 0);
+            it.advance();
+            return it;
+        }
+
+        const_iterator end() const { return const_iterator(words_, Domain); }
+
+        bitset_set &operator|=(const bitset_set &r) {
+            for (size_t i = 0; i < WORDS; ++i) words_[i] |= r.words_[i];
+            return *this;
+        }
+
+        bitset_set &operator&=(const bitset_set &r) {
+            for (size_t i = 0; i < WORDS; ++i) words_[i] &= r.words_[i];
+            return *this;
+        }
+
+        bitset_set &operator-=(const bitset_set &r) {
+            for (size_t i = 0; i < WORDS; ++i) words_[i] &= ~r.words_[i];
+            return *this;
+        }
+
+        bitset_set &operator^=(const bitset_set &r) {
+            for (size_t i = 0; i < WORDS; ++i) words_[i] ^= r.words_[i];
+            return *this;
+        }
+
+        friend bitset_set operator|(bitset_set a, const bitset_set &b) { return a |= b; }
+
+        friend bitset_set operator&(bitset_set a, const bitset_set &b) { return a &= b; }
+
+        friend bitset_set operator-(bitset_set a, const bitset_set &b) { return a -= b; }
+
+        friend bitset_set operator^(bitset_set a, const bitset_set &b) { return a ^= b; }
+
+        // true if every element of r is also in this set
+        bool includes(const bitset_set &r) const {
+            for (size_t i = 0; i < WORDS; ++i)
+                if (r.words_[i] & ~words_[i]) return false;
+            return true;
+        }
+
+        friend bool operator==(const bitset_set &a, const bitset_set &b) {
+            for (size_t i = 0; i < WORDS; ++i)
+                if (a.words_[i] != b.words_[i]) return false;
+            return true;
+        }
+
+        friend bool operator!=(const bitset_set &a, const bitset_set &b) {
+            return !(a == b);
+        }
+
+    private:
+        static uint32_t bit(size_t i) { return uint32_t(1) << (i % 32); }
+
+        bool test(size_t i) const { return (words_[i / 32] & bit(i)) != 0; }
+    };
+
+} // namespace arx
+
+#endif //ARX_BITSET_SET_H
@@ -0,0 +1,205 @@
+#pragma once
+
+#ifndef ARX_CONTAINER_STATS_H
+#define ARX_CONTAINER_STATS_H
+
+// Define ARX_CONTAINER_STATS to 1 (before including any arx header, in every translation unit)
+// to count how the containers are used, e.g. to right-size N from data collected in the field.
+// When it is 0, the hooks are empty inline functions on an empty base class: no code, no RAM.
+#ifndef ARX_CONTAINER_STATS
+#define ARX_CONTAINER_STATS 0
+#endif  // ARX_CONTAINER_STATS
+
+#ifdef ARDUINO
+    #include <Arduino.h>
+#else
+    #include <stdio.h>
+#endif
+#include <stddef.h>
+#include <stdint.h>
+
+namespace arx {
+
+    // Usage counters of one container; all zero unless ARX_CONTAINER_STATS is 1
+    struct container_stats {
+        const char *kind;   // "RingBuffer" (vector, deque, array, map) or "set"
+        const char *name;   // given with stats_name(), nullptr otherwise
+        size_t capacity;
+        size_t size;
+        size_t high_water;  // largest size so far
+        uint32_t pushes;
+        uint32_t pops;
+        uint32_t overwrites;  // elements evicted by a push into a full container
+        uint32_t drops;       // elements not stored because the container was full or had no capacity
+        uint32_t lookups;     // map::find, set search
+        uint32_t probes;      // elements compared by those lookups
+    };
+
+    // copies and heap allocations of all stdx::function objects together
+    struct function_stats {
+        uint32_t copies;
+        uint32_t heap_allocations;
+    };
+
+    namespace detail {
+        inline function_stats &function_stats_counters() {
+            static function_stats counters = {0, 0};
+            return counters;
+        }
+
+#if ARX_CONTAINER_STATS
+        // Base of the instrumented containers: its counters, linked into a registry of every live
+        // container so that they can all be dumped at once
+        class stats_hook {
+            mutable container_stats stats_;
+            stats_hook *prev_;
+            stats_hook *next_;
+
+            static stats_hook *&registry() {
+                static stats_hook *head = nullptr;
+                return head;
+            }
+
+            void link(const char *kind, size_t capacity) {
+                stats_ = container_stats();
+                stats_.kind = kind;
+                stats_.capacity = capacity;
+                prev_ = nullptr;
+                next_ = registry();
+                if (next_) next_->prev_ = this;
+                registry() = this;
+            }
+
+        protected:
+            explicit stats_hook(const char *kind, size_t capacity = 0) { link(kind, capacity); }
+
+            // a copy is a new container with its own counters
+            stats_hook(const stats_hook &r) { link(r.stats_.kind, r.stats_.capacity); }
+
+            stats_hook &operator=(const stats_hook &) { return *this; }
+
+            ~stats_hook() {
+                if (prev_) prev_->next_ = next_;
+                else registry() = next_;
+                if (next_) next_->prev_ = prev_;
+            }
+
+            void stats_capacity(size_t capacity) { stats_.capacity = capacity; }
+
+            void stats_push(size_t size) const {
+                ++stats_.pushes;
+                stats_size(size);
+            }
+
+            void stats_pop(size_t size) const {
+                ++stats_.pops;
+                stats_.size = size;
+            }
+
+            void stats_size(size_t size) const {
+                stats_.size = size;
+                if (size > stats_.high_water) stats_.high_water = size;
+            }
+
+            void stats_overwrite() const { ++stats_.overwrites; }
+
+            void stats_drop(size_t count = 1) const { stats_.drops += static_cast<uint32_t>(count); }
+
+            void stats_lookup(size_t probes) const {
+                ++stats_.lookups;
+                stats_.probes += static_cast<uint32_t>(probes);
+            }
+
+        public:
+            const container_stats &stats() const { return stats_; }
+
+            // label in dump_container_stats(), e.g. "rx_queue" (the string must outlive the container)
+            void stats_name(const char *name) { stats_.name = name; }
+
+            // zeroes the counters; the high-water mark restarts from the current size
+            void stats_reset() {
+                container_stats s = container_stats();
+                s.kind = stats_.kind;
+                s.name = stats_.name;
+                s.capacity = stats_.capacity;
+                s.size = s.high_water = stats_.size;
+                stats_ = s;
+            }
+
+            template<typename F>
+            static void for_each(F f) {
+                for (const stats_hook *h = registry(); h; h = h->next_) f(h->stats_);
+            }
+        };
+#else
+        class stats_hook {
+        protected:
+            explicit stats_hook(const char *, size_t = 0) {}
+
+            void stats_capacity(size_t) {}
+
+            void stats_push(size_t) const {}
+
+            void stats_pop(size_t) const {}
+
+            void stats_size(size_t) const {}
+
+            void stats_overwrite() const {}
+
+            void stats_drop(size_t = 1) const {}
+
+            void stats_lookup(size_t) const {}
+
+        public:
+            const container_stats &stats() const {
+                static const container_stats none = container_stats();
+                return none;
+            }
+
+            void stats_name(const char *) {}
+
+            void stats_reset() {}
+
+            template<typename F>
+            static void for_each(F) {}
+        };
+#endif
+
+        inline void stats_print_line(const char *line) {
+#ifdef ARDUINO
+            Serial.println(line);
+#else
+            puts(line);
+#endif
+        }
+    } // namespace detail
+
+    inline const function_stats &function_usage() { return detail::function_stats_counters(); }
+
+    // calls f(const container_stats &) for every live instrumented container
+    template<typename F>
+    inline void for_each_container_stats(F f) { detail::stats_hook::for_each(f); }
+
+    // one line per live container (and one for all functions) to Serial, or stdout on a host
+    inline void dump_container_stats() {
+        char line[160];
+        for_each_container_stats([&line](const container_stats &s) {
+            snprintf(line, sizeof(line),
+                     "%s %s: size %lu/%lu high %lu push %lu pop %lu overwrite %lu drop %lu lookup %lu probe %lu",
+                     s.kind, s.name ? s.name : "-",
+                     (unsigned long) s.size, (unsigned long) s.capacity, (unsigned long) s.high_water,
+                     (unsigned long) s.pushes, (unsigned long) s.pops, (unsigned long) s.overwrites,
+                     (unsigned long) s.drops, (unsigned long) s.lookups, (unsigned long) s.probes);
+            detail::stats_print_line(line);
+        });
+#if ARX_CONTAINER_STATS
+        const function_stats &f = function_usage();
+        snprintf(line, sizeof(line), "function: copy %lu heap %lu",
+                 (unsigned long) f.copies, (unsigned long) f.heap_allocations);
+        detail::stats_print_line(line);
+#endif
+    }
+
+} // namespace arx
+
+#endif //ARX_CONTAINER_STATS_H
@@ -21,6 +21,9 @@ namespace arx {
 
             deque(std::initializer_list<T> lst) : RingBuffer<T, N>(lst) {}
 
+            // N = dynamic_size only: storage for capacity elements from resource
+            deque(size_t capacity, memory_resource &resource) : RingBuffer<T, N>(capacity, resource) {}
+
             // copy
             deque(const deque &r) : RingBuffer<T, N>(r) {}
 
@@ -30,10 +33,10 @@ namespace arx {
             }
 
             // move
-            deque(deque &&r) : RingBuffer<T, N>(r) {}
+            deque(deque &&r) : RingBuffer<T, N>(stdx::move(r)) {}
 
             deque &operator=(deque &&r) {
-                RingBuffer<T, N>::operator=(r);
+                RingBuffer<T, N>::operator=(stdx::move(r));
                 return *this;
             }
 
@@ -44,6 +47,11 @@ namespace arx {
             using RingBuffer<T, N>::fill;
         };
     } // namespace arx
+
+    namespace pmr {
+        template<typename T>
+        using deque = stdx::deque<T, dynamic_size>;
+    } // namespace pmr
 } // namespace stdx
 
 #endif //ARX_DEQUE_H
@@ -0,0 +1,124 @@
+#pragma once
+
+#ifndef ARX_FROZEN_SET_H
+#define ARX_FROZEN_SET_H
+
+#include "ArxContainer.h"
+#include "Functional.h"
+#include "Set.h"
+
+namespace arx {
+
+    // Read-only set for large, read-mostly lookup tables.
+    // The sorted elements are stored in Eytzinger (BFS) order, so the first levels of
+    // the implicit search tree share cache lines and the search is a branchless descent
+    // that prefetches a few levels ahead.
+    template<typename T, size_t N, typename Compare = stdx::less<T>>
+    class frozen_set {
+        T tree_[N];  // node k (1-based) is tree_[k - 1], children are 2k and 2k + 1
+        size_t count_;
+
+        template<typename K>
+        using EnableIfTransparent = typename stdx::enable_if<
+                stdx::is_transparent<Compare>::value && !stdx::is_same<K, T>::value
+        >::type;
+
+        // prefetch this many levels ahead: all 2^levels descendants of a node are contiguous
+        static const size_t PREFETCH_STRIDE = (sizeof(T) >= 64) ? 1 : 64 / sizeof(T);
+
+    public:
+        frozen_set() : count_(0) {}
+
+        template<size_t M>
+        explicit frozen_set(const stdx::set<T, M, Compare> &s) : count_(0) {
+            assign(s.begin(), s.end());
+        }
+
+        // first..last must be sorted by Compare and free of duplicates (e.g. a set, or a sorted array).
+        // The range is read twice (counted, then copied), so it must be multi-pass: no stream iterators.
+        template<typename ForwardIt>
+        frozen_set(ForwardIt first, ForwardIt last) : count_(0) {
+            assign(first, last);
+        }
+
+        template<typename ForwardIt>
+        void assign(ForwardIt first, ForwardIt last) {
+            count_ = 0;
+            for (ForwardIt it = first; it != last && count_ < N; ++it) ++count_;
+            fill(first, 1);
+        }
+
+        size_t size() const { return count_; }
+
+        bool empty() const { return count_ == 0; }
+
+        size_t capacity() const { return N; }
+
+        bool exist(const T &key) const { return find(key) != end(); }
+
+        template<typename K, typename = EnableIfTransparent<K>>
+        bool exist(const K &key) const { return find(key) != end(); }
+
+        size_t count(const T &key) const { return exist(key) ? 1 : 0; }
+
+        template<typename K, typename = EnableIfTransparent<K>>
+        size_t count(const K &key) const { return exist(key) ? 1 : 0; }
+
+        const T *find(const T &key) const { return find_impl(key); }
+
+        template<typename K, typename = EnableIfTransparent<K>>
+        const T *find(const K &key) const { return find_impl(key); }
+
+        // smallest element not less than key, end() if there is none
+        const T *lower_bound(const T &key) const { return lower_bound_impl(key); }
+
+        template<typename K, typename = EnableIfTransparent<K>>
+        const T *lower_bound(const K &key) const { return lower_bound_impl(key); }
+
+        // iteration visits the elements in layout (BFS) order, not sorted order
+        const T *begin() const { return tree_; }
+
+        const T *end() const { return tree_ + count_; }
+
+    private:
+        template<typename ForwardIt>
+        ForwardIt fill(ForwardIt it, size_t k) {
+            // in-order traversal of the implicit tree visits the nodes in sorted order
+            if (k <= count_) {
+                it = fill(it, 2 * k);
+                tree_[k - 1] = *it;
+                ++it;
+                it = fill(it, 2 * k + 1);
+            }
+            return it;
+        }
+
+        template<typename K>
+        const T *find_impl(const K &key) const {
+            const T *p = lower_bound_impl(key);
+            return (p != end() && !Compare()(key, *p)) ? p : end();
+        }
+
+        template<typename K>
+        const T *lower_bound_impl(const K &key) const {
+            size_t k = 1;
+            while (k <= count_) {
+#if defined(__GNUC__)
+                __builtin_prefetch(reinterpret_cast<const char *>(tree_) + k * PREFETCH_STRIDE * sizeof(T));
+#endif
+                k = 2 * k + (Compare()(tree_[k - 1], key) ? 1 : 0);
+            }
+            // the path went right after the answer: drop the trailing right turns and the last left turn
+            k >>= ctz(~k) + 1;
+            return k ? tree_ + (k - 1) : end();
+        }
+
+        static unsigned ctz(size_t x) {
+            return sizeof(size_t) <= sizeof(unsigned int) ? __builtin_ctz(static_cast<unsigned int>(x))
+                                                          : __builtin_ctzl(static_cast<unsigned long>(x));
+        }
+    };
+
+} // namespace arx
+
+#endif //ARX_FROZEN_SET_H
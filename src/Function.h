@@ -7,137 +7,232 @@
 #define ARX_FUNCTION_BUFFER_DEFAULT_SIZE 8
 #endif  // ARX_FUNCTION_BUFFER_DEFAULT_SIZE
 
+// Callables that don't fit the inline buffer are moved to the heap,
+// except on AVR where it's a compile error instead
+#ifndef ARX_FUNCTION_HEAP_FALLBACK
+    #ifdef __AVR__
+        #define ARX_FUNCTION_HEAP_FALLBACK 0
+    #else
+        #define ARX_FUNCTION_HEAP_FALLBACK 1
+    #endif
+#endif  // ARX_FUNCTION_HEAP_FALLBACK
+
 #ifdef ARDUINO
     #include <Arduino.h>
 #endif
+#include <string.h>
 #include "TypeTraits.h"
+#include "Move.h"
+#include "ContainerStats.h"
 
 namespace arx {
     namespace stdx {
 
-        template<typename>
-        class function;
+        namespace detail {
+            // at least one pointer, so that the heap fallback can always be stored inline
+            template<size_t Bytes>
+            struct function_buffer_size {
+                static const size_t value = Bytes < sizeof(void *) ? sizeof(void *) : Bytes;
+            };
 
-        template<typename Res, typename... Args>
-        class function<Res(Args...)> {
-        private:
-            static const size_t BUFFER_SIZE = ARX_FUNCTION_BUFFER_DEFAULT_SIZE;
-            alignas(sizeof(void *)) char buffer[BUFFER_SIZE];
+            template<typename Callable, size_t BufferSize>
+            struct function_fits_inline {
+                static const bool value =
+                        sizeof(Callable) <= BufferSize &&
+                        alignof(Callable) <= alignof(void *);
+            };
 
-            struct vtable {
-                void (*copy)(const void *src, void *dest);
+            // Callable stored directly in the buffer
+            template<typename Callable, size_t BufferSize,
+                    bool Inline = function_fits_inline<Callable, BufferSize>::value>
+            struct function_storage {
+                static Callable *get(const void *buf) {
+                    return static_cast<Callable *>(const_cast<void *>(buf));
+                }
+
+                static void create(void *buf, Callable &&c) { new(buf) Callable(stdx::move(c)); }
+
+                static void copy(const void *src, void *dest) {
+#if ARX_CONTAINER_STATS
+                    ++::arx::detail::function_stats_counters().copies;
+#endif
+                    new(dest) Callable(*get(src));
+                }
+
+                // move-constructs dest from src and destroys src
+                static void move(void *src, void *dest) {
+                    new(dest) Callable(stdx::move(*get(src)));
+                    get(src)->~Callable();
+                }
+
+                static void destroy(void *buf) { get(buf)->~Callable(); }
+            };
+
+            // Callable on the heap, the buffer only holds the pointer
+            template<typename Callable, size_t BufferSize>
+            struct function_storage<Callable, BufferSize, false> {
+                static_assert(ARX_FUNCTION_HEAP_FALLBACK,
+                              "callable does not fit in the function buffer: increase its size");
+
+                static Callable *get(const void *buf) { return *static_cast<Callable *const *>(buf); }
+
+                static void create(void *buf, Callable &&c) {
+#if ARX_CONTAINER_STATS
+                    ++::arx::detail::function_stats_counters().heap_allocations;
+#endif
+                    *static_cast<Callable **>(buf) = new Callable(stdx::move(c));
+                }
+
+                static void copy(const void *src, void *dest) {
+#if ARX_CONTAINER_STATS
+                    ++::arx::detail::function_stats_counters().copies;
+                    ++::arx::detail::function_stats_counters().heap_allocations;
+#endif
+                    *static_cast<Callable **>(dest) = new Callable(*get(src));
+                }
+
+                static void move(void *src, void *dest) {
+                    *static_cast<Callable **>(dest) = get(src);
+                }
+
+                static void destroy(void *buf) { delete get(buf); }
+            };
+
+            // Lifetime operations of a stored callable. The invoke pointer is kept in the
+            // function object itself, so a call is a single indirection.
+            struct function_move_ops {
+                void (*move)(void *src, void *dest);
+
+                void (*destroy)(void *obj);
+            };
+
+            struct function_ops {
+                void (*move)(void *src, void *dest);
 
                 void (*destroy)(void *obj);
 
-                Res (*invoke)(const void *obj, Args... args);
+                void (*copy)(const void *src, void *dest);
             };
 
-            const vtable *ops = nullptr;
+            // constexpr statics: no guard variable or first-call initialization
+            template<typename Callable, size_t BufferSize>
+            struct function_move_ops_for {
+                using storage = function_storage<Callable, BufferSize>;
+                static constexpr function_move_ops value = {&storage::move, &storage::destroy};
+            };
 
-            template<typename Callable>
-            struct is_small {
-                static const bool value =
-                        sizeof(Callable) <= BUFFER_SIZE &&
-                        alignof(Callable) <= alignof(void *) &&
-                        is_trivially_copyable<Callable>::value;
+            template<typename Callable, size_t BufferSize>
+            constexpr function_move_ops function_move_ops_for<Callable, BufferSize>::value;
+
+            template<typename Callable, size_t BufferSize>
+            struct function_ops_for {
+                using storage = function_storage<Callable, BufferSize>;
+                static constexpr function_ops value = {&storage::move, &storage::destroy, &storage::copy};
+            };
+
+            template<typename Callable, size_t BufferSize>
+            constexpr function_ops function_ops_for<Callable, BufferSize>::value;
+
+            template<typename Res, typename... Args>
+            struct function_invoker {
+                // like std::function, the stored callable is invoked as non-const
+                template<typename Callable, size_t BufferSize>
+                static Res invoke(const void *obj, Args &&... args) {
+                    Callable *callable = function_storage<Callable, BufferSize>::get(obj);
+                    return static_cast<Res>((*callable)(static_cast<Args &&>(args)...));
+                }
+
+                // empty functions return a default-constructed value
+                static Res empty(const void *, Args &&...) { return Res(); }
             };
+        } // namespace detail
+
+        template<typename, size_t = ARX_FUNCTION_BUFFER_DEFAULT_SIZE>
+        class inplace_function;
+
+        template<typename, size_t = ARX_FUNCTION_BUFFER_DEFAULT_SIZE>
+        class unique_function;
+
+        template<typename Res, typename... Args, size_t Bytes>
+        class inplace_function<Res(Args...), Bytes> {
+        private:
+            static const size_t BUFFER_SIZE = detail::function_buffer_size<Bytes>::value;
+
+            using invoker = detail::function_invoker<Res, Args...>;
+
+            Res (*invoke)(const void *obj, Args &&... args) = &invoker::empty;
+            const detail::function_ops *ops = nullptr;
+            alignas(sizeof(void *)) char buffer[BUFFER_SIZE];
+
+            template<typename Callable>
+            using storage = detail::function_storage<Callable, BUFFER_SIZE>;
 
         public:
-            function() = default;
+            inplace_function() = default;
 
             // Function pointer constructor
-            function(Res (*fptr)(Args...)) {
-                if (fptr) {
-                    ops = &get_vtable<Res(*)(Args...)>();
-                    new(buffer) decltype(fptr)(fptr);
-                } else {
-                    ops = nullptr; // Treat nullptr as empty
-                }
+            inplace_function(Res (*fptr)(Args...)) {
+                if (fptr) assign<Res(*)(Args...)>(stdx::move(fptr)); // Treat nullptr as empty
             }
 
             template<typename Callable>
-            using EnableIfSmallAndNotFunction = typename enable_if<
-                    !is_same<Callable, function>::value &&
-                    is_small<Callable>::value
+            using EnableIfNotFunction = typename enable_if<
+                    !is_same<Callable, inplace_function>::value &&
+                    !is_same<Callable, decltype(nullptr)>::value
             >::type;
 
             // Functor constructor
             template<typename Callable>
-            function(Callable c, EnableIfSmallAndNotFunction<Callable> * = nullptr) {
-                ops = &get_vtable<Callable>();
-                new(buffer) Callable(c);
+            inplace_function(Callable c, EnableIfNotFunction<Callable> * = nullptr) {
+                assign<Callable>(stdx::move(c));
             }
 
-            function(function &&other) noexcept {
-                ops = other.ops;
-                if (ops) {
-                    memcpy(buffer, other.buffer, BUFFER_SIZE);
-                    other.ops = nullptr;
-                }
+            inplace_function(inplace_function &&other) noexcept {
+                take(other);
             }
 
-            function(const function &other) {
+            inplace_function(const inplace_function &other) {
                 if (other.ops) {
+                    other.ops->copy(other.buffer, buffer);
                     ops = other.ops;
-                    ops->copy(other.buffer, buffer);
-                } else {
-                    ops = nullptr;
-                    memset(buffer, 0, BUFFER_SIZE);
+                    invoke = other.invoke;
                 }
             }
 
-            ~function() {
-                if (ops && ops->destroy) ops->destroy(buffer);
+            ~inplace_function() {
+                reset();
             }
 
-            function(decltype(nullptr)) noexcept : ops(nullptr) {
-                memset(buffer, 0, BUFFER_SIZE);
-            }
+            inplace_function(decltype(nullptr)) noexcept {}
 
+            // arguments are passed on by reference, so by-value parameters are copied only once
             Res operator()(Args... args) const {
-                if (!ops || !ops->invoke) {
-                    return invoke_return(static_cast<Res *>(nullptr));
-                }
-                return ops->invoke(buffer, args...);
+                return invoke(buffer, static_cast<Args &&>(args)...);
             }
 
-            function &operator=(const function &other) {
+            inplace_function &operator=(const inplace_function &other) {
                 if (this != &other) {
-                    if (ops && ops->destroy) ops->destroy(buffer);
+                    reset();
                     if (other.ops) {
+                        other.ops->copy(other.buffer, buffer);
                         ops = other.ops;
-                        ops->copy(other.buffer, buffer);
-                    } else {
-                        ops = nullptr;
-                        memset(buffer, 0, BUFFER_SIZE);
+                        invoke = other.invoke;
                     }
                 }
                 return *this;
             }
 
-            function &operator=(function &&other) noexcept {
+            inplace_function &operator=(inplace_function &&other) noexcept {
                 if (this != &other) {
                     // Destroy current contents
-                    if (ops && ops->destroy) {
-                        ops->destroy(buffer);
-                    }
-                    ops = other.ops;
-                    if (ops) {
-                        memcpy(buffer, other.buffer, BUFFER_SIZE);
-                        other.ops = nullptr;
-                    } else {
-                        memset(buffer, 0, BUFFER_SIZE);
-                    }
+                    reset();
+                    take(other);
                 }
                 return *this;
             }
 
-            function &operator=(decltype(nullptr)) noexcept {
-                if (ops && ops->destroy) {
-                    ops->destroy(buffer); // Destroy stored callable
-                }
-                ops = nullptr;
-                memset(buffer, 0, BUFFER_SIZE); // Clear buffer
+            inplace_function &operator=(decltype(nullptr)) noexcept {
+                reset(); // Destroy stored callable
                 return *this;
             }
 
@@ -151,38 +246,130 @@ namespace arx {
 
             explicit operator bool() const { return ops != nullptr; }
 
+            // true if the callable lives in the inline buffer (always true for empty functions)
+            template<typename Callable>
+            static constexpr bool stored_inline() { return detail::function_fits_inline<Callable, BUFFER_SIZE>::value; }
+
         private:
-            // Return type handling
-            template<typename T>
-            static T invoke_return(T *) { return T(); }
+            template<typename Callable>
+            void assign(Callable &&c) {
+                storage<Callable>::create(buffer, stdx::move(c));
+                ops = &detail::function_ops_for<Callable, BUFFER_SIZE>::value;
+                invoke = &invoker::template invoke<Callable, BUFFER_SIZE>;
+            }
+
+            void take(inplace_function &other) {
+                if (!other.ops) return;
+                other.ops->move(other.buffer, buffer);
+                ops = other.ops;
+                invoke = other.invoke;
+                other.ops = nullptr;
+                other.invoke = &invoker::empty;
+            }
 
-            static void invoke_return(void *) {}
+            void reset() {
+                if (ops) ops->destroy(buffer);
+                ops = nullptr;
+                invoke = &invoker::empty;
+            }
+        };
+
+        template<typename Signature>
+        using function = inplace_function<Signature, ARX_FUNCTION_BUFFER_DEFAULT_SIZE>;
+
+        // Move-only counterpart of inplace_function for callables that own resources
+        // (unique handles, moved-in buffers): the vtable has no copy entry, so the callable
+        // only needs to be move-constructible.
+        template<typename Res, typename... Args, size_t Bytes>
+        class unique_function<Res(Args...), Bytes> {
+        private:
+            static const size_t BUFFER_SIZE = detail::function_buffer_size<Bytes>::value;
+
+            using invoker = detail::function_invoker<Res, Args...>;
+
+            Res (*invoke)(const void *obj, Args &&... args) = &invoker::empty;
+            const detail::function_move_ops *ops = nullptr;
+            alignas(sizeof(void *)) char buffer[BUFFER_SIZE];
+
+            template<typename Callable>
+            using storage = detail::function_storage<Callable, BUFFER_SIZE>;
 
             template<typename Callable>
-            static const vtable &get_vtable() {
-                static const vtable instance = create_vtable<Callable>();
-                return instance;
+            using EnableIfNotFunction = typename enable_if<
+                    !is_same<typename remove_cvref<Callable>::type, unique_function>::value &&
+                    !is_same<typename remove_cvref<Callable>::type, decltype(nullptr)>::value
+            >::type;
+
+        public:
+            unique_function() = default;
+
+            unique_function(decltype(nullptr)) noexcept {}
+
+            unique_function(Res (*fptr)(Args...)) {
+                if (fptr) assign<Res(*)(Args...)>(stdx::move(fptr));
             }
 
+            // Callable is taken by forwarding reference and moved in, it is never copied
+            template<typename Callable, typename = EnableIfNotFunction<Callable>>
+            unique_function(Callable &&c) {
+                using C = typename remove_cvref<Callable>::type;
+                assign<C>(C(static_cast<Callable &&>(c)));
+            }
+
+            unique_function(unique_function &&other) noexcept {
+                take(other);
+            }
+
+            unique_function(const unique_function &) = delete;
+
+            unique_function &operator=(const unique_function &) = delete;
+
+            ~unique_function() { reset(); }
+
+            unique_function &operator=(unique_function &&other) noexcept {
+                if (this != &other) {
+                    reset();
+                    take(other);
+                }
+                return *this;
+            }
+
+            unique_function &operator=(decltype(nullptr)) noexcept {
+                reset();
+                return *this;
+            }
+
+            Res operator()(Args... args) const {
+                return invoke(buffer, static_cast<Args &&>(args)...);
+            }
+
+            bool operator!=(decltype(nullptr)) const noexcept { return ops != nullptr; }
+
+            bool operator==(decltype(nullptr)) const noexcept { return ops == nullptr; }
+
+            explicit operator bool() const { return ops != nullptr; }
+
+        private:
             template<typename Callable>
-            static vtable create_vtable() {
-                return {
-                        // COPY
-                        [](const void *src, void *dest) {
-                            new(dest) Callable(*static_cast<const Callable *>(src));
-                        },
-                        // DESTROY
-                        [](void *obj) { static_cast<Callable *>(obj)->~Callable(); },
-                        // INVOKE (FIXED)
-                        [](const void *obj, Args... args) -> Res {
-                            const Callable *callable = static_cast<const Callable *>(obj);
-                            if (is_void<Res>::value) {
-                                (*callable)(args...);  // No return for void
-                            } else {
-                                return (*callable)(args...);  // Return value
-                            }
-                        }
-                };
+            void assign(Callable &&c) {
+                storage<Callable>::create(buffer, stdx::move(c));
+                ops = &detail::function_move_ops_for<Callable, BUFFER_SIZE>::value;
+                invoke = &invoker::template invoke<Callable, BUFFER_SIZE>;
+            }
+
+            void take(unique_function &other) {
+                if (!other.ops) return;
+                other.ops->move(other.buffer, buffer);
+                ops = other.ops;
+                invoke = other.invoke;
+                other.ops = nullptr;
+                other.invoke = &invoker::empty;
+            }
+
+            void reset() {
+                if (ops) ops->destroy(buffer);
+                ops = nullptr;
+                invoke = &invoker::empty;
             }
         };
     } // namespace stdx
@@ -0,0 +1,62 @@
+#pragma once
+
+#ifndef ARX_FUNCTION_REF_H
+#define ARX_FUNCTION_REF_H
+
+#include "TypeTraits.h"
+
+namespace arx {
+    namespace stdx {
+
+        template<typename>
+        class function_ref;
+
+        // Non-owning reference to a callable: an object pointer plus a trampoline, trivially copyable.
+        // The referenced callable must outlive the function_ref, so it's meant for callback parameters.
+        template<typename Res, typename... Args>
+        class function_ref<Res(Args...)> {
+            union target {
+                void *obj;
+                Res (*fptr)(Args...);
+            };
+
+            target target_;
+            Res (*call_)(target, Args &&...);
+
+            template<typename Callable>
+            using EnableIfNotFunctionRef = typename enable_if<
+                    !is_same<typename remove_cvref<Callable>::type, function_ref>::value
+            >::type;
+
+        public:
+            function_ref(Res (*fptr)(Args...)) : call_(&call_fptr) {
+                target_.fptr = fptr;
+            }
+
+            template<typename Callable, typename = EnableIfNotFunctionRef<Callable>>
+            function_ref(Callable &&c) : call_(&call_obj<typename remove_reference<Callable>::type>) {
+                target_.obj = const_cast<void *>(static_cast<const volatile void *>(&c));
+            }
+
+            function_ref(const function_ref &) = default;
+
+            function_ref &operator=(const function_ref &) = default;
+
+            Res operator()(Args... args) const {
+                return call_(target_, static_cast<Args &&>(args)...);
+            }
+
+        private:
+            static Res call_fptr(target t, Args &&... args) {
+                return t.fptr(static_cast<Args &&>(args)...);
+            }
+
+            template<typename Callable>
+            static Res call_obj(target t, Args &&... args) {
+                return static_cast<Res>((*static_cast<Callable *>(t.obj))(static_cast<Args &&>(args)...));
+            }
+        };
+    } // namespace stdx
+} // namespace arx
+
+#endif //ARX_FUNCTION_REF_H
@@ -0,0 +1,189 @@
+#pragma once
+
+#ifndef ARX_FUNCTIONAL_H
+#define ARX_FUNCTIONAL_H
+
+#ifdef ARDUINO
+    #include <Arduino.h>
+#endif
+#include <string.h>
+#include <stdint.h>
+#include "config/has_libstdcplusplus.h"
+#include "TypeTraits.h"
+
+// With a C++11 standard library and without USE_ARX_LIB, less / greater / equal_to / hash are the
+// std ones: std imports arx::stdx (see ArxContainer.h), so arx definitions of the same names would
+// make them ambiguous after `using namespace std`.
+#ifndef ARX_STD_FUNCTIONAL
+    #if (ARX_HAVE_LIBSTDCPLUSPLUS >= 201103L) && !USE_ARX_LIB
+        #define ARX_STD_FUNCTIONAL 1
+    #else
+        #define ARX_STD_FUNCTIONAL 0
+    #endif
+#endif  // ARX_STD_FUNCTIONAL
+
+#if ARX_STD_FUNCTIONAL
+    #include <functional>
+#endif
+
+namespace arx {
+    namespace stdx {
+
+        namespace detail {
+            // Key views used by the transparent functors, so that String and
+            // const char* can be compared and hashed without building a temporary
+            inline const char *c_str_of(const char *s) { return s; }
+
+#ifdef ARDUINO
+            inline const char *c_str_of(const String &s) { return s.c_str(); }
+#endif
+
+            // any other string type with c_str(), e.g. arx::inplace_string
+            template<typename S>
+            inline auto c_str_of(const S &s) -> decltype(s.c_str()) { return s.c_str(); }
+
+            template<typename T, typename = void>
+            struct is_c_string_like {
+                static const bool value = false;
+            };
+
+            template<typename T>
+            struct is_c_string_like<T, decltype((void) c_str_of(declval<const T &>()))> {
+                static const bool value = true;
+            };
+
+            template<typename A, typename B>
+            struct both_c_string_like {
+                static const bool value = is_c_string_like<A>::value && is_c_string_like<B>::value;
+            };
+        } // namespace detail
+
+#if ARX_STD_FUNCTIONAL
+        using std::less;
+        using std::greater;
+        using std::equal_to;
+        using std::hash;
+#else
+        template<typename T = void>
+        struct less {
+            bool operator()(const T &a, const T &b) const { return a < b; }
+        };
+
+        template<typename T>
+        struct greater {
+            bool operator()(const T &a, const T &b) const { return b < a; }
+        };
+
+        template<typename T = void>
+        struct equal_to {
+            bool operator()(const T &a, const T &b) const { return a == b; }
+        };
+
+        // Transparent versions: enable heterogeneous lookup (e.g. String keys with const char*)
+        template<>
+        struct less<void> {
+            using is_transparent = void;
+
+            template<typename A, typename B>
+            typename enable_if<!detail::both_c_string_like<A, B>::value, bool>::type
+            operator()(const A &a, const B &b) const { return a < b; }
+
+            template<typename A, typename B>
+            typename enable_if<detail::both_c_string_like<A, B>::value, bool>::type
+            operator()(const A &a, const B &b) const {
+                return strcmp(detail::c_str_of(a), detail::c_str_of(b)) < 0;
+            }
+        };
+
+        template<>
+        struct equal_to<void> {
+            using is_transparent = void;
+
+            template<typename A, typename B>
+            typename enable_if<!detail::both_c_string_like<A, B>::value, bool>::type
+            operator()(const A &a, const B &b) const { return a == b; }
+
+            template<typename A, typename B>
+            typename enable_if<detail::both_c_string_like<A, B>::value, bool>::type
+            operator()(const A &a, const B &b) const {
+                return strcmp(detail::c_str_of(a), detail::c_str_of(b)) == 0;
+            }
+        };
+
+#endif  // ARX_STD_FUNCTIONAL
+
+        // FNV-1a, used for strings and as the fallback for integral keys
+        inline size_t hash_bytes(const void *ptr, size_t len) {
+            const uint8_t *p = static_cast<const uint8_t *>(ptr);
+            uint32_t h = 2166136261UL;
+            for (size_t i = 0; i < len; ++i) {
+                h ^= p[i];
+                h *= 16777619UL;
+            }
+            return static_cast<size_t>(h);
+        }
+
+        inline size_t hash_c_str(const char *s) {
+            uint32_t h = 2166136261UL;
+            while (*s) {
+                h ^= static_cast<uint8_t>(*s++);
+                h *= 16777619UL;
+            }
+            return static_cast<size_t>(h);
+        }
+
+#if !ARX_STD_FUNCTIONAL
+        template<typename T = void>
+        struct hash {
+            size_t operator()(const T &t) const { return hash_bytes(&t, sizeof(T)); }
+        };
+
+        template<>
+        struct hash<const char *> {
+            size_t operator()(const char *s) const { return hash_c_str(s); }
+        };
+
+#ifdef ARDUINO
+        template<>
+        struct hash<String> {
+            size_t operator()(const String &s) const { return hash_c_str(s.c_str()); }
+        };
+#endif
+
+        // Transparent hasher: String and const char* with the same contents hash equally
+        template<>
+        struct hash<void> {
+            using is_transparent = void;
+
+            template<typename A>
+            typename enable_if<!detail::is_c_string_like<A>::value, size_t>::type
+            operator()(const A &a) const { return hash<A>()(a); }
+
+            template<typename A>
+            typename enable_if<detail::is_c_string_like<A>::value, size_t>::type
+            operator()(const A &a) const { return hash_c_str(detail::c_str_of(a)); }
+        };
+#endif  // !ARX_STD_FUNCTIONAL
+
+        template<typename Compare, typename = void>
+        struct is_transparent {
+            static const bool value = false;
+        };
+
+        template<typename Compare>
+        struct is_transparent<Compare, typename Compare::is_transparent> {
+            static const bool value = true;
+        };
+    } // namespace stdx
+} // namespace arx
+
+#if ARX_STD_FUNCTIONAL && defined(ARDUINO)
+namespace std {
+    template<>
+    struct hash<String> {
+        size_t operator()(const String &s) const { return ::arx::stdx::hash_c_str(s.c_str()); }
+    };
+} // namespace std
+#endif
+
+#endif //ARX_FUNCTIONAL_H
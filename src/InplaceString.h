@@ -0,0 +1,210 @@
+#pragma once
+
+#ifndef ARX_INPLACE_STRING_H
+#define ARX_INPLACE_STRING_H
+
+#ifdef ARDUINO
+    #include <Arduino.h>
+#endif
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "ArxContainer.h"
+#include "Functional.h"
+
+namespace arx {
+
+    namespace detail {
+        // smallest type that holds a length up to N
+        template<size_t N, bool Byte = (N < 0x100), bool Half = (N < 0x10000)>
+        struct inplace_string_size {
+            using type = size_t;
+        };
+
+        template<size_t N, bool Half>
+        struct inplace_string_size<N, true, Half> {
+            using type = uint8_t;
+        };
+
+        template<size_t N>
+        struct inplace_string_size<N, false, true> {
+            using type = uint16_t;
+        };
+    } // namespace detail
+
+    // String of up to N chars stored inline, with its length cached, as a heap-free key for map / set.
+    // Bytes past the end are kept zero, so equality compares the whole buffer as a fixed-size
+    // memcmp, which compilers turn into a few word loads. Longer input is truncated to N chars.
+    template<size_t N>
+    class inplace_string {
+        // the buffer holds the terminator and is padded to whole words (N = 16: 24 bytes on 64-bit)
+        static const size_t BYTES = (N + sizeof(uintptr_t)) / sizeof(uintptr_t) * sizeof(uintptr_t);
+
+        using size_type = typename detail::inplace_string_size<N>::type;
+
+        union {
+            char chars[BYTES];
+            uintptr_t align;
+        } buf_;
+        size_type len_;
+
+    public:
+        inplace_string() : len_(0) { memset(buf_.chars, 0, BYTES); }
+
+        inplace_string(const char *s) : len_(0) {
+            memset(buf_.chars, 0, BYTES);
+            append(s);
+        }
+
+        inplace_string(const char *s, size_t n) : len_(0) {
+            memset(buf_.chars, 0, BYTES);
+            append(s, n);
+        }
+
+#ifdef ARDUINO
+        inplace_string(const String &s) : len_(0) {
+            memset(buf_.chars, 0, BYTES);
+            append(s.c_str(), s.length());
+        }
+#endif
+
+        inplace_string &operator=(const char *s) {
+            clear();
+            append(s);
+            return *this;
+        }
+
+#ifdef ARDUINO
+        inplace_string &operator=(const String &s) {
+            clear();
+            append(s.c_str(), s.length());
+            return *this;
+        }
+#endif
+
+        const char *c_str() const { return buf_.chars; }
+
+        const char *data() const { return buf_.chars; }
+
+        size_t size() const { return len_; }
+
+        size_t length() const { return len_; }
+
+        static constexpr size_t capacity() { return N; }
+
+        bool empty() const { return len_ == 0; }
+
+        bool full() const { return len_ == N; }
+
+        // read-only, so that the length and the zero padding stay valid
+        char operator[](size_t i) const { return buf_.chars[i]; }
+
+        const char *begin() const { return buf_.chars; }
+
+        const char *end() const { return buf_.chars + len_; }
+
+        void clear() {
+            memset(buf_.chars, 0, len_);
+            len_ = 0;
+        }
+
+        // appends up to n chars of s (stopping at a terminator), returns false if truncated
+        bool append(const char *s, size_t n) {
+            size_t i = 0;
+            while (i < n && s[i] && len_ < N) buf_.chars[len_++] = s[i++];
+            return i == n || !s[i];
+        }
+
+        bool append(const char *s) { return append(s, size_t(-1)); }
+
+        bool push_back(char c) {
+            if (len_ == N || c == '\0') return false;
+            buf_.chars[len_++] = c;
+            return true;
+        }
+
+        void pop_back() {
+            if (len_) buf_.chars[--len_] = '\0';
+        }
+
+        inplace_string &operator+=(const char *s) {
+            append(s);
+            return *this;
+        }
+
+        inplace_string &operator+=(char c) {
+            push_back(c);
+            return *this;
+        }
+
+        // <0, 0, >0 like strcmp
+        int compare(const char *s) const { return strcmp(buf_.chars, s); }
+
+        int compare(const inplace_string &r) const {
+            return memcmp(buf_.chars, r.buf_.chars, (len_ < r.len_ ? len_ : r.len_) + 1);
+        }
+
+        bool operator==(const inplace_string &r) const {
+            return len_ == r.len_ && memcmp(buf_.chars, r.buf_.chars, BYTES) == 0;
+        }
+
+        bool operator!=(const inplace_string &r) const { return !(*this == r); }
+
+        bool operator<(const inplace_string &r) const { return compare(r) < 0; }
+
+        bool operator>(const inplace_string &r) const { return r < *this; }
+
+        bool operator<=(const inplace_string &r) const { return !(r < *this); }
+
+        bool operator>=(const inplace_string &r) const { return !(*this < r); }
+
+        friend bool operator==(const inplace_string &a, const char *b) { return a.compare(b) == 0; }
+
+        friend bool operator==(const char *a, const inplace_string &b) { return b.compare(a) == 0; }
+
+        friend bool operator!=(const inplace_string &a, const char *b) { return a.compare(b) != 0; }
+
+        friend bool operator!=(const char *a, const inplace_string &b) { return b.compare(a) != 0; }
+
+        friend bool operator<(const inplace_string &a, const char *b) { return a.compare(b) < 0; }
+
+        friend bool operator<(const char *a, const inplace_string &b) { return b.compare(a) > 0; }
+
+#ifdef ARDUINO
+        friend bool operator==(const inplace_string &a, const String &b) { return a.compare(b.c_str()) == 0; }
+
+        friend bool operator==(const String &a, const inplace_string &b) { return b.compare(a.c_str()) == 0; }
+
+        friend bool operator!=(const inplace_string &a, const String &b) { return a.compare(b.c_str()) != 0; }
+
+        friend bool operator!=(const String &a, const inplace_string &b) { return b.compare(a.c_str()) != 0; }
+
+        friend bool operator<(const inplace_string &a, const String &b) { return a.compare(b.c_str()) < 0; }
+
+        friend bool operator<(const String &a, const inplace_string &b) { return b.compare(a.c_str()) > 0; }
+#endif
+    };
+
+#if !ARX_STD_FUNCTIONAL
+    namespace stdx {
+        // same value as hash<const char *> / hash<String> for the same contents
+        template<size_t N>
+        struct hash<inplace_string<N>> {
+            size_t operator()(const inplace_string<N> &s) const { return hash_bytes(s.data(), s.size()); }
+        };
+    } // namespace stdx
+#endif
+
+} // namespace arx
+
+#if ARX_STD_FUNCTIONAL
+namespace std {
+    // stdx::hash is std::hash here (see Functional.h)
+    template<size_t N>
+    struct hash<arx::inplace_string<N>> {
+        size_t operator()(const arx::inplace_string<N> &s) const { return arx::stdx::hash_bytes(s.data(), s.size()); }
+    };
+} // namespace std
+#endif
+
+#endif //ARX_INPLACE_STRING_H
@@ -0,0 +1,248 @@
+#pragma once
+
+#ifndef ARX_INTRUSIVE_LIST_H
+#define ARX_INTRUSIVE_LIST_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "ArxContainer.h"
+
+namespace arx {
+
+    // Links of an object in an intrusive_list / intrusive_queue, embedded as a member of the object:
+    //
+    //   struct Job { list_hook hook; uint8_t payload[64]; };
+    //   intrusive_list<Job, &Job::hook> idle, pending;
+    //
+    // An object can be in one list per hook at a time. Copying an object does not copy its links.
+    struct list_hook {
+        list_hook *prev{nullptr};
+        list_hook *next{nullptr};
+
+        list_hook() = default;
+
+        list_hook(const list_hook &) {}
+
+        list_hook &operator=(const list_hook &) { return *this; }
+
+        bool linked() const { return next != nullptr; }
+    };
+
+    namespace detail {
+        // the object that holds hook h as its Hook member
+        template<typename T, list_hook T::*Hook>
+        inline T *hook_owner(list_hook *h) {
+            // offset of the member, measured on an aligned dummy address that is never accessed
+            T *probe = reinterpret_cast<T *>(uintptr_t(alignof(T)) * 16);
+            const uintptr_t offset = reinterpret_cast<uintptr_t>(&(probe->*Hook)) - reinterpret_cast<uintptr_t>(probe);
+            return reinterpret_cast<T *>(reinterpret_cast<char *>(h) - offset);
+        }
+    } // namespace detail
+
+    // Doubly-linked list of objects that carry their own links (a list_hook member), so putting an
+    // object in a list, taking it out or moving it to another list is O(1) and never copies or
+    // allocates. The list does not own its objects; they must outlive their membership.
+    template<typename T, list_hook T::*Hook>
+    class intrusive_list {
+        list_hook head_;  // sentinel of the circular list
+        size_t size_;
+
+        template<typename V>
+        class Iterator {
+            friend class intrusive_list;
+
+            template<typename>
+            friend class Iterator;
+
+            list_hook *node_;
+
+        public:
+            explicit Iterator(list_hook *node = nullptr) : node_(node) {}
+
+            // copy, and iterator to const_iterator
+            Iterator(const Iterator<T> &r) : node_(r.node_) {}
+
+            V &operator*() const { return *detail::hook_owner<T, Hook>(node_); }
+
+            V *operator->() const { return detail::hook_owner<T, Hook>(node_); }
+
+            Iterator &operator++() {
+                node_ = node_->next;
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                Iterator it = *this;
+                node_ = node_->next;
+                return it;
+            }
+
+            Iterator &operator--() {
+                node_ = node_->prev;
+                return *this;
+            }
+
+            Iterator operator--(int) {
+                Iterator it = *this;
+                node_ = node_->prev;
+                return it;
+            }
+
+            bool operator==(const Iterator &r) const { return node_ == r.node_; }
+
+            bool operator!=(const Iterator &r) const { return node_ != r.node_; }
+        };
+
+    public:
+        using iterator = Iterator<T>;
+        using const_iterator = Iterator<const T>;
+
+        intrusive_list() : size_(0) {
+            head_.prev = head_.next = &head_;
+        }
+
+        intrusive_list(const intrusive_list &) = delete;
+
+        intrusive_list &operator=(const intrusive_list &) = delete;
+
+        // objects still in the list are unlinked, so they can be put in another one
+        ~intrusive_list() { clear(); }
+
+        size_t size() const { return size_; }
+
+        bool empty() const { return size_ == 0; }
+
+        iterator begin() { return iterator(head_.next); }
+
+        iterator end() { return iterator(&head_); }
+
+        const_iterator begin() const { return const_iterator(head_.next); }
+
+        const_iterator end() const { return const_iterator(const_cast<list_hook *>(&head_)); }
+
+        // undefined if empty
+        T &front() { return *begin(); }
+
+        const T &front() const { return *begin(); }
+
+        T &back() { return *iterator(head_.prev); }
+
+        const T &back() const { return *const_iterator(head_.prev); }
+
+        // false (and nothing happens) if t is already in a list through this hook
+        bool push_front(T &t) { return insert(begin(), t) != end(); }
+
+        bool push_back(T &t) { return insert(end(), t) != end(); }
+
+        // the removed object, nullptr if empty
+        T *pop_front() { return empty() ? nullptr : &erase(front()); }
+
+        T *pop_back() { return empty() ? nullptr : &erase(back()); }
+
+        // inserts t before pos, returns end() if t is already linked
+        iterator insert(const_iterator pos, T &t) {
+            list_hook *h = &(t.*Hook);
+            if (h->linked()) return end();
+            link_before(pos.node_, h);
+            ++size_;
+            return iterator(h);
+        }
+
+        // removes the element at pos, returns the one after it
+        iterator erase(const_iterator pos) {
+            list_hook *next = pos.node_->next;
+            unlink(pos.node_);
+            --size_;
+            return iterator(next);
+        }
+
+        // removes t, which must be in this list, and returns it
+        T &erase(T &t) {
+            unlink(&(t.*Hook));
+            --size_;
+            return t;
+        }
+
+        // the position of t, which must be in this list
+        iterator iterator_to(T &t) { return iterator(&(t.*Hook)); }
+
+        const_iterator iterator_to(const T &t) const {
+            return const_iterator(const_cast<list_hook *>(&(t.*Hook)));
+        }
+
+        void clear() {
+            list_hook *h = head_.next;
+            while (h != &head_) {
+                list_hook *next = h->next;
+                h->prev = h->next = nullptr;
+                h = next;
+            }
+            head_.prev = head_.next = &head_;
+            size_ = 0;
+        }
+
+        // moves every element of other before pos in O(1)
+        void splice(const_iterator pos, intrusive_list &other) {
+            if (&other == this || other.empty()) return;
+            list_hook *first = other.head_.next;
+            list_hook *last = other.head_.prev;
+            other.head_.prev = other.head_.next = &other.head_;
+            list_hook *at = pos.node_;
+            first->prev = at->prev;
+            at->prev->next = first;
+            last->next = at;
+            at->prev = last;
+            size_ += other.size_;
+            other.size_ = 0;
+        }
+
+        // moves t from other before pos in O(1)
+        void splice(const_iterator pos, intrusive_list &other, T &t) {
+            list_hook *h = &(t.*Hook);
+            if (h == pos.node_) return;
+            other.unlink(h);
+            --other.size_;
+            link_before(pos.node_, h);
+            ++size_;
+        }
+
+    private:
+        static void link_before(list_hook *at, list_hook *h) {
+            h->next = at;
+            h->prev = at->prev;
+            at->prev->next = h;
+            at->prev = h;
+        }
+
+        static void unlink(list_hook *h) {
+            h->prev->next = h->next;
+            h->next->prev = h->prev;
+            h->prev = h->next = nullptr;
+        }
+    };
+
+    // FIFO of hooked objects. It is an intrusive_list restricted to push() at the back and pop()
+    // at the front (erase() still takes out any element), so objects move between queues and
+    // lists that use the same hook in O(1).
+    template<typename T, list_hook T::*Hook>
+    class intrusive_queue : public intrusive_list<T, Hook> {
+        using base = intrusive_list<T, Hook>;
+
+    public:
+        // false if t is already queued
+        bool push(T &t) { return base::push_back(t); }
+
+        // the oldest object, nullptr if empty
+        T *pop() { return base::pop_front(); }
+
+    private:
+        using base::push_front;
+        using base::push_back;
+        using base::pop_front;
+        using base::pop_back;
+        using base::insert;
+    };
+
+} // namespace arx
+
+#endif //ARX_INTRUSIVE_LIST_H
@@ -0,0 +1,253 @@
+#pragma once
+
+#ifndef ARX_LRU_CACHE_H
+#define ARX_LRU_CACHE_H
+
+#ifndef ARX_LRU_CACHE_DEFAULT_SIZE
+#define ARX_LRU_CACHE_DEFAULT_SIZE 16
+#endif  // ARX_LRU_CACHE_DEFAULT_SIZE
+
+#include <stdint.h>
+#include "ArxContainer.h"
+#include "Functional.h"
+
+namespace arx {
+
+    namespace detail {
+        // power of two, at least twice the capacity to keep probe sequences short
+        constexpr size_t lru_table_size(size_t n, size_t sz = 1) {
+            return sz >= n * 2 ? sz : lru_table_size(n, sz * 2);
+        }
+    } // namespace detail
+
+    // Fixed-capacity LRU cache with inline storage.
+    // Entries live in a node array linked by 16-bit indices (most recent at head_),
+    // and are found through an open-addressing hash index, so get/put/evict are O(1).
+    template<class Key, class T, size_t N = ARX_LRU_CACHE_DEFAULT_SIZE,
+            class Hash = stdx::hash<Key>, class KeyEqual = stdx::equal_to<Key>>
+    class lru_cache {
+        static_assert(N > 0 && N < 0xFFFF, "lru_cache capacity must fit in 16-bit links");
+
+        using index_t = uint16_t;
+        static const index_t NIL = 0xFFFF;
+
+        static const size_t TABLE_SIZE = detail::lru_table_size(N);
+        static const size_t TABLE_MASK = TABLE_SIZE - 1;
+
+        struct Node {
+            Key key;
+            T value;
+            size_t hash;
+            index_t prev;
+            index_t next;
+        };
+
+        Node nodes_[N];
+        index_t table_[TABLE_SIZE];  // node index + 1, 0 = empty slot
+        index_t head_;  // most recently used
+        index_t tail_;  // least recently used
+        index_t free_;  // singly linked through Node::next
+        size_t size_;
+        stdx::function<void(const Key &, T &)> on_evict_;
+
+        template<typename K>
+        using EnableIfTransparent = typename stdx::enable_if<
+                stdx::is_transparent<Hash>::value &&
+                stdx::is_transparent<KeyEqual>::value &&
+                !stdx::is_same<K, Key>::value
+        >::type;
+
+    public:
+        lru_cache() { clear(); }
+
+        size_t size() const { return size_; }
+
+        size_t capacity() const { return N; }
+
+        bool empty() const { return size_ == 0; }
+
+        bool full() const { return size_ == N; }
+
+        void clear() {
+            for (size_t i = 0; i < TABLE_SIZE; ++i) table_[i] = 0;
+            for (size_t i = 0; i < N; ++i) {
+                nodes_[i].key = Key();
+                nodes_[i].value = T();
+                nodes_[i].next = static_cast<index_t>(i + 1 < N ? i + 1 : NIL);
+            }
+            head_ = tail_ = NIL;
+            free_ = 0;
+            size_ = 0;
+        }
+
+        // called with the key and value of every entry dropped to make room
+        void on_evict(const stdx::function<void(const Key &, T &)> &cb) { on_evict_ = cb; }
+
+        // returns nullptr if not cached, otherwise marks the entry as most recently used
+        T *get(const Key &key) { return get_impl(key); }
+
+        template<typename K, typename = EnableIfTransparent<K>>
+        T *get(const K &key) { return get_impl(key); }
+
+        // lookup without touching the recency order
+        const T *peek(const Key &key) const { return peek_impl(key); }
+
+        template<typename K, typename = EnableIfTransparent<K>>
+        const T *peek(const K &key) const { return peek_impl(key); }
+
+        bool contains(const Key &key) const { return find_slot(key, Hash()(key)) != TABLE_SIZE; }
+
+        template<typename K, typename = EnableIfTransparent<K>>
+        bool contains(const K &key) const { return find_slot(key, Hash()(key)) != TABLE_SIZE; }
+
+        // inserts or overwrites, evicting the least recently used entry when full
+        T &put(const Key &key, const T &value) {
+            const size_t h = Hash()(key);
+            size_t slot = find_slot(key, h);
+            if (slot != TABLE_SIZE) {
+                index_t i = table_[slot] - 1;
+                nodes_[i].value = value;
+                touch(i);
+                return nodes_[i].value;
+            }
+
+            if (full()) evict(tail_);
+
+            index_t i = free_;
+            free_ = nodes_[i].next;
+            nodes_[i].key = key;
+            nodes_[i].value = value;
+            nodes_[i].hash = h;
+            link_front(i);
+            table_[insert_slot(h)] = i + 1;
+            ++size_;
+            return nodes_[i].value;
+        }
+
+        bool erase(const Key &key) { return erase_impl(key); }
+
+        template<typename K, typename = EnableIfTransparent<K>>
+        bool erase(const K &key) { return erase_impl(key); }
+
+        // least recently used entry, the next one to be evicted
+        const Key *lru_key() const { return tail_ == NIL ? nullptr : &nodes_[tail_].key; }
+
+        // iterate from most to least recently used
+        template<typename F>
+        void for_each(F f) const {
+            for (index_t i = head_; i != NIL; i = nodes_[i].next)
+                f(nodes_[i].key, nodes_[i].value);
+        }
+
+    private:
+        template<typename K>
+        T *get_impl(const K &key) {
+            size_t slot = find_slot(key, Hash()(key));
+            if (slot == TABLE_SIZE) return nullptr;
+            index_t i = table_[slot] - 1;
+            touch(i);
+            return &nodes_[i].value;
+        }
+
+        template<typename K>
+        const T *peek_impl(const K &key) const {
+            size_t slot = find_slot(key, Hash()(key));
+            if (slot == TABLE_SIZE) return nullptr;
+            return &nodes_[table_[slot] - 1].value;
+        }
+
+        template<typename K>
+        bool erase_impl(const K &key) {
+            size_t slot = find_slot(key, Hash()(key));
+            if (slot == TABLE_SIZE) return false;
+            index_t i = table_[slot] - 1;
+            remove_slot(slot);
+            unlink(i);
+            release(i);
+            return true;
+        }
+
+        void evict(index_t i) {
+            remove_slot(find_node_slot(i));
+            unlink(i);
+            if (on_evict_) on_evict_(nodes_[i].key, nodes_[i].value);
+            release(i);
+        }
+
+        void release(index_t i) {
+            nodes_[i].key = Key();
+            nodes_[i].value = T();
+            nodes_[i].next = free_;
+            free_ = i;
+            --size_;
+        }
+
+        // returns TABLE_SIZE if the key is not present
+        template<typename K>
+        size_t find_slot(const K &key, size_t h) const {
+            for (size_t s = h & TABLE_MASK;; s = (s + 1) & TABLE_MASK) {
+                index_t v = table_[s];
+                if (v == 0) return TABLE_SIZE;
+                const Node &n = nodes_[v - 1];
+                if (n.hash == h && KeyEqual()(n.key, key)) return s;
+            }
+        }
+
+        size_t find_node_slot(index_t i) const {
+            size_t s = nodes_[i].hash & TABLE_MASK;
+            while (table_[s] != i + 1) s = (s + 1) & TABLE_MASK;
+            return s;
+        }
+
+        size_t insert_slot(size_t h) const {
+            size_t s = h & TABLE_MASK;
+            while (table_[s] != 0) s = (s + 1) & TABLE_MASK;
+            return s;
+        }
+
+        // backward-shift deletion keeps linear probing free of tombstones
+        void remove_slot(size_t hole) {
+            size_t s = hole;
+            for (;;) {
+                s = (s + 1) & TABLE_MASK;
+                index_t v = table_[s];
+                if (v == 0) break;
+                size_t home = nodes_[v - 1].hash & TABLE_MASK;
+                bool stays = (hole <= s) ? (hole < home && home <= s) : (hole < home || home <= s);
+                if (stays) continue;
+                table_[hole] = v;
+                hole = s;
+            }
+            table_[hole] = 0;
+        }
+
+        void link_front(index_t i) {
+            nodes_[i].prev = NIL;
+            nodes_[i].next = head_;
+            if (head_ != NIL) nodes_[head_].prev = i;
+            head_ = i;
+            if (tail_ == NIL) tail_ = i;
+        }
+
+        void unlink(index_t i) {
+            const index_t p = nodes_[i].prev;
+            const index_t n = nodes_[i].next;
+            if (p != NIL) nodes_[p].next = n;
+            else head_ = n;
+            if (n != NIL) nodes_[n].prev = p;
+            else tail_ = p;
+        }
+
+        void touch(index_t i) {
+            if (i == head_) return;
+            unlink(i);
+            link_front(i);
+        }
+    };
+
+} // namespace arx
+
+template<class Key, class T, size_t N = ARX_LRU_CACHE_DEFAULT_SIZE>
+using ArxLruCache = arx::lru_cache<Key, T, N>;
+
+#endif //ARX_LRU_CACHE_H
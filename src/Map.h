@@ -8,21 +8,39 @@
 #endif  // ARX_MAP_DEFAULT_SIZE
 
 #include "Pair.h"
+#include "Functional.h"
 #include "RingBuffer.h"
 
 namespace arx {
     namespace stdx {
 
-        template<class Key, class T, size_t N = ARX_MAP_DEFAULT_SIZE>
+        template<class Key, class T, size_t N = ARX_MAP_DEFAULT_SIZE, class KeyEqual = equal_to<Key>>
         struct map : public RingBuffer<pair<Key, T>, N> {
             using base = RingBuffer<pair<Key, T>, N>;
             using iterator = typename base::iterator;
             using const_iterator = typename base::const_iterator;
 
+        private:
+            // Heterogeneous overloads are only available with a transparent KeyEqual (e.g. equal_to<>)
+            // integral and iterator arguments are left to erase(index) / erase(iterator)
+            template<typename K>
+            using EnableIfTransparent = typename enable_if<
+                    is_transparent<KeyEqual>::value &&
+                    !is_same<K, Key>::value &&
+                    !is_integral<K>::value &&
+                    !is_same<K, iterator>::value &&
+                    !is_same<K, const_iterator>::value
+            >::type;
+
+        public:
+
             map() : base() {}
 
             map(std::initializer_list<pair<Key, T> > lst) : base(lst) {}
 
+            // N = dynamic_size only: storage for capacity entries from resource
+            map(size_t capacity, memory_resource &resource) : base(capacity, resource) {}
+
             // copy
             map(const map &r) : base(r) {}
 
@@ -32,27 +50,38 @@ namespace arx {
             }
 
             // move
-            map(map &&r) : base(r) {}
+            map(map &&r) : base(stdx::move(r)) {}
 
             map &operator=(map &&r) {
-                base::operator=(r);
+                base::operator=(stdx::move(r));
                 return *this;
             }
 
             const_iterator find(const Key &key) const {
-                for (const_iterator it = this->begin(); it != this->end(); ++it) {
-                    if (key == it->first)
-                        return it;
-                }
-                return this->end();
+                return find_key(key);
             }
 
             iterator find(const Key &key) {
-                for (iterator it = this->begin(); it != this->end(); ++it) {
-                    if (key == it->first)
-                        return it;
-                }
-                return this->end();
+                return find_key(key).to_iterator();
+            }
+
+            template<typename K, typename = EnableIfTransparent<K>>
+            const_iterator find(const K &key) const {
+                return find_key(key);
+            }
+
+            template<typename K, typename = EnableIfTransparent<K>>
+            iterator find(const K &key) {
+                return find_key(key).to_iterator();
+            }
+
+            size_t count(const Key &key) const {
+                return find_key(key) == this->end() ? 0 : 1;
+            }
+
+            template<typename K, typename = EnableIfTransparent<K>>
+            size_t count(const K &key) const {
+                return find_key(key) == this->end() ? 0 : 1;
             }
 
             pair<iterator, bool> insert(const Key &key, const T &t) {
@@ -63,6 +92,7 @@ namespace arx {
                 bool b{false};
                 iterator it = find(p.first);
                 if (it == this->end()) {
+                    if (this->capacity() == 0) return {it, false};  // a runtime capacity that ran out
                     this->push(p);
                     b = true;
                     it = this->begin() + this->size() - 1;
@@ -100,6 +130,20 @@ namespace arx {
                 //return find(key)->second;
             }
 
+            template<typename K, typename = EnableIfTransparent<K>>
+            const T &at(const K &key) const {
+                const_iterator it = find(key);
+                if (it != this->end()) return it->second;
+                return empty_value();
+            }
+
+            template<typename K, typename = EnableIfTransparent<K>>
+            T &at(const K &key) {
+                iterator it = find(key);
+                if (it != this->end()) return it->second;
+                return empty_value();
+            }
+
             iterator erase(const const_iterator &it) {
                 iterator i = find(it->first);
                 return base::erase(i);
@@ -110,6 +154,12 @@ namespace arx {
                 return base::erase(i);
             }
 
+            template<typename K, typename = EnableIfTransparent<K>>
+            iterator erase(const K &key) {
+                iterator i = find(key);
+                return base::erase(i);
+            }
+
             // erase() will cause compile error if map's Key is 'unsigned int'
             // => collision of this method with erase(const Key&)
             iterator erase(const size_t index) {
@@ -124,11 +174,25 @@ namespace arx {
                 iterator it = find(key);
                 if (it != this->end()) return it->second;
 
-                insert(::arx::stdx::make_pair(key, T()));
+                if (!insert(::arx::stdx::make_pair(key, T())).second) return empty_value();
                 return this->back().second;
             }
 
         private:
+            template<typename K>
+            const_iterator find_key(const K &key) const {
+                size_t probes = 0;
+                for (const_iterator it = this->begin(); it != this->end(); ++it) {
+                    ++probes;
+                    if (KeyEqual()(it->first, key)) {
+                        this->stats_lookup(probes);
+                        return it;
+                    }
+                }
+                this->stats_lookup(probes);
+                return this->end();
+            }
+
             using base::assign;
             using base::back;
             using base::capacity;
@@ -146,6 +210,11 @@ namespace arx {
             using base::fill;
         };
     } //  namespace stdx
+
+    namespace pmr {
+        template<class Key, class T, class KeyEqual = stdx::equal_to<Key>>
+        using map = stdx::map<Key, T, dynamic_size, KeyEqual>;
+    } // namespace pmr
 } // namespace arx
 
 #endif //ARX_MAP_H
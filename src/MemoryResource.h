@@ -0,0 +1,205 @@
+#pragma once
+
+#ifndef ARX_MEMORY_RESOURCE_H
+#define ARX_MEMORY_RESOURCE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#if !defined(_NEW) || !defined(NEW_H)
+    #include <new>
+#endif
+
+namespace arx {
+
+    // Capacity argument for containers whose storage comes from a memory_resource at runtime,
+    // e.g. stdx::vector<int, dynamic_size> v(64, arena) (see the arx::pmr aliases).
+    // Like std::dynamic_extent, it is no capacity a fixed container could have.
+    static constexpr size_t dynamic_size = size_t(-1);
+
+    namespace detail {
+        // strictest fundamental alignment
+        union max_align {
+            long long ll;
+            long double ld;
+            void *ptr;
+        };
+    } // namespace detail
+
+    // Source of storage for containers with dynamic_size, modeled on std::pmr::memory_resource.
+    // allocate() returns nullptr instead of throwing when it runs out.
+    class memory_resource {
+    public:
+        virtual ~memory_resource() {}
+
+        void *allocate(size_t bytes, size_t alignment = alignof(detail::max_align)) {
+            return do_allocate(bytes, alignment);
+        }
+
+        void deallocate(void *p, size_t bytes, size_t alignment = alignof(detail::max_align)) {
+            if (p) do_deallocate(p, bytes, alignment);
+        }
+
+    protected:
+        virtual void *do_allocate(size_t bytes, size_t alignment) = 0;
+
+        virtual void do_deallocate(void *p, size_t bytes, size_t alignment) = 0;
+    };
+
+    // Bump allocator over a caller-provided buffer. Deallocation only gives memory back when it is
+    // the most recent allocation; everything else is reclaimed at once by release(), e.g. at the end
+    // of a request, so the transient containers of one request share the same peak memory.
+    class monotonic_buffer_resource : public memory_resource {
+        char *buffer_;
+        size_t size_;
+        size_t used_;
+        size_t peak_;
+
+    public:
+        monotonic_buffer_resource(void *buffer, size_t size)
+        : buffer_(static_cast<char *>(buffer)), size_(size), used_(0), peak_(0) {}
+
+        monotonic_buffer_resource(const monotonic_buffer_resource &) = delete;
+
+        monotonic_buffer_resource &operator=(const monotonic_buffer_resource &) = delete;
+
+        // frees everything allocated so far; containers using it must be gone (or not used again)
+        void release() { used_ = 0; }
+
+        size_t used() const { return used_; }
+
+        size_t remaining() const { return size_ - used_; }
+
+        size_t capacity() const { return size_; }
+
+        // most bytes ever in use at once
+        size_t peak() const { return peak_; }
+
+    protected:
+        void *do_allocate(size_t bytes, size_t alignment) override {
+            const uintptr_t base = reinterpret_cast<uintptr_t>(buffer_);
+            const uintptr_t aligned = (base + used_ + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+            const size_t offset = static_cast<size_t>(aligned - base);
+            if (offset > size_ || bytes > size_ - offset) return nullptr;
+            used_ = offset + bytes;
+            if (used_ > peak_) peak_ = used_;
+            return buffer_ + offset;
+        }
+
+        void do_deallocate(void *p, size_t bytes, size_t) override {
+            // LIFO frees (a temporary container destroyed before the next one is made) are reclaimed
+            if (static_cast<char *>(p) + bytes == buffer_ + used_) used_ = static_cast<size_t>(static_cast<char *>(p) - buffer_);
+        }
+    };
+
+    // monotonic_buffer_resource with its own inline buffer of Bytes bytes
+    template<size_t Bytes>
+    class arena : public monotonic_buffer_resource {
+        union {
+            char bytes[Bytes];
+            detail::max_align align;
+        } storage_;
+
+    public:
+        arena() : monotonic_buffer_resource(storage_.bytes, Bytes) {}
+    };
+
+    // memory_resource on top of a block_pool (see Pool.h); allocations larger than a block fail
+    template<typename Pool>
+    class pool_resource : public memory_resource {
+        Pool &pool_;
+
+    public:
+        explicit pool_resource(Pool &pool) : pool_(pool) {}
+
+    protected:
+        void *do_allocate(size_t bytes, size_t alignment) override {
+            return alignment <= Pool::block_align ? pool_.allocate(bytes) : nullptr;
+        }
+
+        void do_deallocate(void *p, size_t, size_t) override { pool_.deallocate(p); }
+    };
+
+    namespace detail {
+        // Element storage of the containers: an inline array for a fixed N ...
+        template<typename T, size_t N>
+        struct container_storage {
+            static_assert(N > 0, "a container of capacity 0 holds nothing, use dynamic_size for a runtime capacity");
+
+            T elems_[N];
+
+            container_storage() : elems_() {}
+
+            // the containers copy their elements themselves, only as many as are in use
+            container_storage(const container_storage &) : elems_() {}
+
+            container_storage &operator=(const container_storage &) { return *this; }
+
+            static constexpr size_t extent() { return N; }
+
+            // storage is never shared between fixed containers, elements are copied instead
+            bool take(container_storage &) { return false; }
+
+            memory_resource *resource() const { return nullptr; }
+        };
+
+        // ... or, for dynamic_size, capacity elements allocated from a memory_resource.
+        // If the resource runs out, the container has a capacity of 0.
+        template<typename T>
+        struct container_storage<T, dynamic_size> {
+            T *elems_;
+            size_t extent_;
+            memory_resource *resource_;
+
+            container_storage() : elems_(nullptr), extent_(0), resource_(nullptr) {}
+
+            container_storage(size_t capacity, memory_resource &resource)
+            : elems_(nullptr), extent_(0), resource_(&resource) {
+                allocate(capacity);
+            }
+
+            // copies get the same capacity from the same resource
+            container_storage(const container_storage &r)
+            : elems_(nullptr), extent_(0), resource_(r.resource_) {
+                if (resource_) allocate(r.extent_);
+            }
+
+            // assignment keeps this buffer and capacity
+            container_storage &operator=(const container_storage &) { return *this; }
+
+            ~container_storage() {
+                for (size_t i = 0; i < extent_; ++i) elems_[i].~T();
+                if (resource_) resource_->deallocate(elems_, extent_ * sizeof(T), alignof(T));
+            }
+
+            size_t extent() const { return extent_; }
+
+            // swaps the buffers, so that moving a container never copies elements
+            bool take(container_storage &r) {
+                T *e = elems_;
+                elems_ = r.elems_;
+                r.elems_ = e;
+                size_t n = extent_;
+                extent_ = r.extent_;
+                r.extent_ = n;
+                memory_resource *m = resource_;
+                resource_ = r.resource_;
+                r.resource_ = m;
+                return true;
+            }
+
+            memory_resource *resource() const { return resource_; }
+
+        private:
+            void allocate(size_t capacity) {
+                void *p = capacity ? resource_->allocate(capacity * sizeof(T), alignof(T)) : nullptr;
+                if (!p) return;
+                elems_ = static_cast<T *>(p);
+                for (size_t i = 0; i < capacity; ++i) new(elems_ + i) T();
+                extent_ = capacity;
+            }
+        };
+    } // namespace detail
+
+} // namespace arx
+
+#endif //ARX_MEMORY_RESOURCE_H
@@ -0,0 +1,260 @@
+#pragma once
+
+#ifndef ARX_POOL_H
+#define ARX_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "ArxContainer.h"
+
+#ifdef __AVR__
+    #include <avr/io.h>
+    #include <avr/interrupt.h>
+#endif
+
+namespace arx {
+
+    namespace detail {
+        static const uint16_t POOL_NIL = 0xFFFF;
+
+        // Free list of a pool, linked through the free blocks by 16-bit indices, plus usage stats.
+        template<bool ThreadSafe>
+        struct pool_free_list {
+            uint16_t head;
+            uint16_t in_use;
+            uint16_t high_water;
+            uint16_t failures;
+
+            void reset(uint16_t first) {
+                head = first;
+                in_use = high_water = failures = 0;
+            }
+
+            template<typename Block>
+            uint16_t pop(Block *blocks) {
+                const uint16_t i = head;
+                if (i == POOL_NIL) {
+                    if (failures != 0xFFFF) ++failures;
+                    return i;
+                }
+                head = blocks[i].next;
+                if (++in_use > high_water) high_water = in_use;
+                return i;
+            }
+
+            template<typename Block>
+            void push(Block *blocks, uint16_t i) {
+                blocks[i].next = head;
+                head = i;
+                --in_use;
+            }
+        };
+
+#ifdef __AVR__
+        // AVR has no compare-and-swap: the list is updated with interrupts disabled,
+        // which only takes a few cycles and is safe to use from an ISR
+        template<>
+        struct pool_free_list<true> : pool_free_list<false> {
+            template<typename Block>
+            uint16_t pop(Block *blocks) {
+                const uint8_t sreg = SREG;
+                cli();
+                const uint16_t i = pool_free_list<false>::pop(blocks);
+                SREG = sreg;
+                return i;
+            }
+
+            template<typename Block>
+            void push(Block *blocks, uint16_t i) {
+                const uint8_t sreg = SREG;
+                cli();
+                pool_free_list<false>::push(blocks, i);
+                SREG = sreg;
+            }
+        };
+#else
+        // Lock-free (Treiber stack) free list. The head packs the block index with a tag that is
+        // bumped by every pop, so a stale compare-and-swap after an ABA reuse fails.
+        template<>
+        struct pool_free_list<true> {
+            uint32_t head;  // (tag << 16) | index
+            uint16_t in_use;
+            uint16_t high_water;
+            uint16_t failures;
+
+            void reset(uint16_t first) {
+                __atomic_store_n(&head, uint32_t(first), __ATOMIC_RELAXED);
+                in_use = high_water = failures = 0;
+            }
+
+            template<typename Block>
+            uint16_t pop(Block *blocks) {
+                uint32_t h = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+                for (;;) {
+                    const uint16_t i = static_cast<uint16_t>(h & 0xFFFF);
+                    if (i == POOL_NIL) {
+                        // saturates at 0xFFFF like the plain counter
+                        uint16_t f = __atomic_load_n(&failures, __ATOMIC_RELAXED);
+                        while (f != 0xFFFF &&
+                               !__atomic_compare_exchange_n(&failures, &f, uint16_t(f + 1), true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {}
+                        return i;
+                    }
+                    // may read a link that another thread is overwriting: the tag makes the CAS fail then
+                    const uint16_t next = __atomic_load_n(&blocks[i].next, __ATOMIC_RELAXED);
+                    const uint32_t desired = ((h & 0xFFFF0000UL) + 0x10000UL) | next;
+                    if (__atomic_compare_exchange_n(&head, &h, desired, true, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+                        const uint16_t used = __atomic_add_fetch(&in_use, 1, __ATOMIC_RELAXED);
+                        uint16_t hw = __atomic_load_n(&high_water, __ATOMIC_RELAXED);
+                        while (used > hw &&
+                               !__atomic_compare_exchange_n(&high_water, &hw, used, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {}
+                        return i;
+                    }
+                }
+            }
+
+            template<typename Block>
+            void push(Block *blocks, uint16_t i) {
+                uint32_t h = __atomic_load_n(&head, __ATOMIC_RELAXED);
+                for (;;) {
+                    __atomic_store_n(&blocks[i].next, static_cast<uint16_t>(h & 0xFFFF), __ATOMIC_RELAXED);
+                    const uint32_t desired = (h & 0xFFFF0000UL) | i;
+                    if (__atomic_compare_exchange_n(&head, &h, desired, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+                        break;
+                }
+                __atomic_sub_fetch(&in_use, 1, __ATOMIC_RELAXED);
+            }
+        };
+#endif
+    } // namespace detail
+
+    // Fixed pool of N untyped blocks of BlockSize bytes in static (inline) storage.
+    // Free blocks form an intrusive list threaded through the storage itself, so allocate() and
+    // deallocate() are O(1) and the pool never fragments. With ThreadSafe, the free list can be
+    // used from interrupts and other threads: lock-free where compare-and-swap exists,
+    // with interrupts briefly disabled on AVR.
+    template<size_t BlockSize, size_t N, bool ThreadSafe = false>
+    class block_pool {
+        static_assert(N > 0 && N < 0xFFFF, "block_pool size must fit in 16-bit indices");
+
+        union Block {
+            uint16_t next;  // while the block is free
+            char data[BlockSize];
+            // alignment for any fundamental type
+            long long align_ll;
+            long double align_ld;
+            void *align_ptr;
+        };
+
+        Block blocks_[N];
+        detail::pool_free_list<ThreadSafe> free_;
+
+    public:
+        static const size_t block_size = BlockSize;
+        static const size_t block_align = alignof(Block);
+
+        block_pool() { clear(); }
+
+        block_pool(const block_pool &) = delete;
+
+        block_pool &operator=(const block_pool &) = delete;
+
+        // nullptr when the pool is exhausted
+        void *allocate() {
+            const uint16_t i = free_.pop(blocks_);
+            return i == detail::POOL_NIL ? nullptr : blocks_[i].data;
+        }
+
+        // nullptr if bytes don't fit in a block, so a pool can back any fixed-size heap spill
+        void *allocate(size_t bytes) { return bytes <= BlockSize ? allocate() : nullptr; }
+
+        // p must come from this pool (or be nullptr)
+        void deallocate(void *p) {
+            if (!p) return;
+            free_.push(blocks_, index_of(p));
+        }
+
+        bool owns(const void *p) const {
+            const char *c = static_cast<const char *>(p);
+            const char *first = reinterpret_cast<const char *>(blocks_);
+            return c >= first && c < first + sizeof(blocks_) && (c - first) % sizeof(Block) == 0;
+        }
+
+        // returns every block to the pool; blocks still in use must not be touched afterwards
+        void clear() {
+            for (size_t i = 0; i < N; ++i)
+                blocks_[i].next = static_cast<uint16_t>(i + 1 < N ? i + 1 : detail::POOL_NIL);
+            free_.reset(0);
+        }
+
+        size_t size() const { return free_.in_use; }
+
+        size_t available() const { return N - free_.in_use; }
+
+        bool empty() const { return free_.in_use == 0; }
+
+        bool full() const { return free_.in_use == N; }
+
+        size_t capacity() const { return N; }
+
+        // largest number of blocks ever in use at the same time
+        size_t high_water() const { return free_.high_water; }
+
+        // number of allocations that failed because the pool was exhausted (saturates at 65535)
+        size_t failures() const { return free_.failures; }
+
+    private:
+        uint16_t index_of(const void *p) const {
+            return static_cast<uint16_t>(
+                    (static_cast<const char *>(p) - reinterpret_cast<const char *>(blocks_)) / sizeof(Block));
+        }
+    };
+
+    // Typed pool of N objects of T on top of block_pool.
+    template<typename T, size_t N, bool ThreadSafe = false>
+    class object_pool {
+        using blocks_type = block_pool<sizeof(T), N, ThreadSafe>;
+        static_assert(alignof(T) <= blocks_type::block_align, "object_pool does not support over-aligned types");
+
+        blocks_type blocks_;
+
+    public:
+        // constructs a T in a free slot, nullptr when the pool is exhausted
+        template<typename... Args>
+        T *create(Args &&... args) {
+            void *p = blocks_.allocate();
+            return p ? new(p) T(static_cast<Args &&>(args)...) : nullptr;
+        }
+
+        // destroys an object from create() and returns its slot
+        void destroy(T *p) {
+            if (!p) return;
+            p->~T();
+            blocks_.deallocate(p);
+        }
+
+        bool owns(const T *p) const { return blocks_.owns(p); }
+
+        size_t size() const { return blocks_.size(); }
+
+        size_t available() const { return blocks_.available(); }
+
+        bool empty() const { return blocks_.empty(); }
+
+        bool full() const { return blocks_.full(); }
+
+        size_t capacity() const { return N; }
+
+        size_t high_water() const { return blocks_.high_water(); }
+
+        size_t failures() const { return blocks_.failures(); }
+    };
+
+} // namespace arx
+
+template<size_t BlockSize, size_t N>
+using ArxBlockPool = arx::block_pool<BlockSize, N>;
+
+template<typename T, size_t N>
+using ArxObjectPool = arx::object_pool<T, N>;
+
+#endif //ARX_POOL_H
@@ -0,0 +1,263 @@
+#pragma once
+
+#ifndef ARX_PRIORITY_QUEUE_H
+#define ARX_PRIORITY_QUEUE_H
+
+#ifndef ARX_PRIORITY_QUEUE_DEFAULT_SIZE
+#define ARX_PRIORITY_QUEUE_DEFAULT_SIZE 16
+#endif  // ARX_PRIORITY_QUEUE_DEFAULT_SIZE
+
+// Children per node. A 4-ary heap is half as deep as a binary one, with adjacent children, so it
+// moves large elements less often and touches fewer cache lines once the heap outgrows the cache.
+// For small elements the binary heap needs fewer comparisons (see bench/bench_priority_queue.cpp).
+#ifndef ARX_PRIORITY_QUEUE_DEFAULT_ARITY
+#define ARX_PRIORITY_QUEUE_DEFAULT_ARITY 2
+#endif  // ARX_PRIORITY_QUEUE_DEFAULT_ARITY
+
+#include <stdint.h>
+#include "ArxContainer.h"
+#include "Functional.h"
+#include "Move.h"
+
+namespace arx {
+    namespace stdx {
+
+        // Fixed-capacity d-ary heap with inline storage. As with std::priority_queue, top() is the
+        // element for which Compare holds against every other one (the largest with less<T>).
+        // push() returns a handle that stays valid while the element is queued, so it can be
+        // re-prioritized (update() / decrease_key()) or removed (erase()) in O(log N).
+        template<typename T, size_t N = ARX_PRIORITY_QUEUE_DEFAULT_SIZE, typename Compare = less<T>,
+                size_t Arity = ARX_PRIORITY_QUEUE_DEFAULT_ARITY>
+        class priority_queue {
+            static_assert(N > 0 && N < 0xFFFF, "priority_queue capacity must fit in 16-bit indices");
+            static_assert(Arity >= 2, "priority_queue needs at least two children per node");
+
+            using index_t = uint16_t;
+            static const index_t NIL = 0xFFFF;
+
+        public:
+            struct handle {
+                index_t index{NIL};
+                index_t generation{0};
+
+                bool valid() const { return index != NIL; }
+            };
+
+        private:
+            struct Entry {
+                T value;
+                index_t slot;
+            };
+
+            struct Slot {
+                index_t pos;  // position in heap_ while queued
+                index_t generation;
+            };
+
+            // heap_[0, size_) is the heap; the entries past size_ keep the ids of the free slots
+            Entry heap_[N];
+            Slot slots_[N];
+            size_t size_;
+            Compare comp_;
+
+        public:
+            explicit priority_queue(const Compare &comp = Compare()) : size_(0), comp_(comp) {
+                for (size_t i = 0; i < N; ++i) {
+                    heap_[i].slot = static_cast<index_t>(i);
+                    slots_[i].pos = NIL;
+                    slots_[i].generation = 0;
+                }
+            }
+
+            priority_queue(std::initializer_list<T> lst, const Compare &comp = Compare()) : priority_queue(comp) {
+                for (const auto &v : lst) push(v);
+            }
+
+            size_t size() const { return size_; }
+
+            size_t capacity() const { return N; }
+
+            bool empty() const { return size_ == 0; }
+
+            bool full() const { return size_ == N; }
+
+            // undefined if empty
+            const T &top() const { return heap_[0].value; }
+
+            // returns an invalid handle if the queue is full
+            handle push(const T &value) {
+                if (full()) return handle();
+                heap_[size_].value = value;
+                return link();
+            }
+
+            handle push(T &&value) {
+                if (full()) return handle();
+                heap_[size_].value = stdx::move(value);
+                return link();
+            }
+
+            template<typename... Args>
+            handle emplace(Args &&... args) {
+                return push(T(static_cast<Args &&>(args)...));
+            }
+
+            void pop() {
+                if (!empty()) remove(0);
+            }
+
+            void clear() {
+                while (size_) {
+                    --size_;
+                    release(size_);
+                }
+            }
+
+            bool contains(const handle &h) const {
+                return h.index < N && slots_[h.index].generation == h.generation && slots_[h.index].pos != NIL;
+            }
+
+            // the queued value of h, nullptr if h is no longer queued
+            const T *get(const handle &h) const {
+                return contains(h) ? &heap_[slots_[h.index].pos].value : nullptr;
+            }
+
+            // gives h a new value and restores the heap order around it
+            bool update(const handle &h, const T &value) {
+                if (!contains(h)) return false;
+                const size_t i = slots_[h.index].pos;
+                heap_[i].value = value;
+                if (i > 0 && comp_(heap_[parent(i)].value, heap_[i].value))
+                    sift_up(i);
+                else
+                    sift_down(i);
+                return true;
+            }
+
+            // moves h towards the top; value must not rank below its current one.
+            // with greater<T> (a min-heap) this is the classic decrease-key
+            bool decrease_key(const handle &h, const T &value) {
+                if (!contains(h)) return false;
+                const size_t i = slots_[h.index].pos;
+                heap_[i].value = value;
+                sift_up(i);
+                return true;
+            }
+
+            bool erase(handle &h) {
+                if (!contains(h)) return false;
+                remove(slots_[h.index].pos);
+                h = handle();
+                return true;
+            }
+
+        private:
+            static size_t parent(size_t i) { return (i - 1) / Arity; }
+
+            handle link() {
+                const size_t i = size_++;
+                const index_t s = heap_[i].slot;
+                slots_[s].pos = static_cast<index_t>(i);
+                sift_up(i);
+                handle h;
+                h.index = s;
+                h.generation = slots_[s].generation;
+                return h;
+            }
+
+            // removes the entry at heap position i and refills the hole with the last entry
+            void remove(size_t i) {
+                --size_;
+                const index_t s = heap_[i].slot;
+                if (i != size_) {
+                    Entry e = stdx::move(heap_[size_]);
+                    heap_[size_].slot = s;
+                    if (i == 0)
+                        sift_down_from_top(stdx::move(e));
+                    else if (comp_(heap_[parent(i)].value, e.value))
+                        sift_up(i, stdx::move(e));
+                    else
+                        sift_down(i, stdx::move(e));
+                }
+                release(size_);
+            }
+
+            // frees the slot of heap_[i] (i >= size_) and drops its value
+            void release(size_t i) {
+                Slot &s = slots_[heap_[i].slot];
+                s.pos = NIL;
+                ++s.generation;
+                heap_[i].value = T();
+            }
+
+            void place(size_t i, Entry &&e) {
+                heap_[i] = stdx::move(e);
+                slots_[heap_[i].slot].pos = static_cast<index_t>(i);
+            }
+
+            // the entry is taken out first: the hole overwrites heap_[i]
+            void sift_up(size_t i) {
+                Entry e = stdx::move(heap_[i]);
+                sift_up(i, stdx::move(e));
+            }
+
+            void sift_down(size_t i) {
+                Entry e = stdx::move(heap_[i]);
+                sift_down(i, stdx::move(e));
+            }
+
+            // first child of i that ranks highest, size_ if i is a leaf
+            size_t best_child(size_t i) const {
+                const size_t first = Arity * i + 1;
+                if (first >= size_) return size_;
+                size_t best = first;
+                if (first + Arity <= size_) {
+                    // all children present: fixed trip count, unrolled by the compiler
+                    for (size_t c = 1; c < Arity; ++c)
+                        if (comp_(heap_[best].value, heap_[first + c].value)) best = first + c;
+                } else {
+                    for (size_t c = first + 1; c < size_; ++c)
+                        if (comp_(heap_[best].value, heap_[c].value)) best = c;
+                }
+                return best;
+            }
+
+            // e fills the hole at i; the entries it passes are moved into the hole instead
+            void sift_up(size_t i, Entry &&e) {
+                while (i > 0) {
+                    const size_t p = parent(i);
+                    if (!comp_(heap_[p].value, e.value)) break;
+                    place(i, stdx::move(heap_[p]));
+                    i = p;
+                }
+                place(i, stdx::move(e));
+            }
+
+            void sift_down(size_t i, Entry &&e) {
+                for (;;) {
+                    const size_t best = best_child(i);
+                    if (best == size_ || !comp_(e.value, heap_[best].value)) break;
+                    place(i, stdx::move(heap_[best]));
+                    i = best;
+                }
+                place(i, stdx::move(e));
+            }
+
+            // after pop() the refill comes from the bottom and almost always goes back there, so the
+            // hole is walked down to a leaf without comparing against e, then e is sifted up from it
+            void sift_down_from_top(Entry &&e) {
+                size_t i = 0;
+                for (;;) {
+                    const size_t best = best_child(i);
+                    if (best == size_) break;
+                    place(i, stdx::move(heap_[best]));
+                    i = best;
+                }
+                sift_up(i, stdx::move(e));
+            }
+        };
+
+    } // namespace stdx
+} // namespace arx
+
+#endif //ARX_PRIORITY_QUEUE_H
@@ -3,60 +3,168 @@
 #ifndef ARX_RINGBUFFER_H
 #define ARX_RINGBUFFER_H
 
+// Trivially copyable elements are moved by one type-erased core shared by all instantiations,
+// which saves flash when several vector / deque / map types are used. 0 keeps the typed loops
+#ifndef ARX_RINGBUFFER_SHARED_CORE
+#define ARX_RINGBUFFER_SHARED_CORE 1
+#endif  // ARX_RINGBUFFER_SHARED_CORE
+
+#ifndef ARX_NOINLINE
+    #if defined(__GNUC__)
+        #define ARX_NOINLINE __attribute__((noinline))
+    #else
+        #define ARX_NOINLINE
+    #endif
+#endif  // ARX_NOINLINE
+
 #include <limits.h>
+#include <string.h>
 #include "ArxContainer.h"
 #include "Move.h"
+#include "TypeTraits.h"
+#include "MemoryResource.h"
+#include "Pair.h"
+#include "Span.h"
+#include "ContainerStats.h"
 
 namespace arx {
 
+    namespace detail {
+        // capacity as seen by the iterators: a constant for a fixed N, carried along for dynamic_size
+        template<size_t N>
+        struct ring_extent {
+            ring_extent() {}
+
+            explicit ring_extent(size_t) {}
+
+            static constexpr size_t extent() { return N; }
+        };
+
+        template<>
+        struct ring_extent<dynamic_size> {
+            size_t extent_{0};
+
+            ring_extent() {}
+
+            explicit ring_extent(size_t n) : extent_(n) {}
+
+            size_t extent() const { return extent_; }
+        };
+
+        // Element moves of RingBuffer<T, N> for trivially copyable T, on raw bytes with the element
+        // size and capacity given at runtime. Every instantiation shares this one copy of the code
+        // instead of its own typed loops (see ARX_RINGBUFFER_SHARED_CORE).
+        struct ring_core {
+            unsigned char *elems;
+            size_t elem_size;
+            size_t capacity;
+            size_t head;  // slot of element 0
+
+            size_t slot(size_t i) const {
+                const size_t s = head + i;
+                return s < capacity ? s : s - capacity;
+            }
+
+            unsigned char *at(size_t i) const { return elems + slot(i) * elem_size; }
+
+            // moves elements [src, src + count) to [dst, dst + count); the ranges may overlap
+            ARX_NOINLINE void move(size_t dst, size_t src, size_t count) const {
+                if (dst < src) {
+                    // front to back, one memmove per piece that does not wrap around
+                    while (count) {
+                        size_t n = count;
+                        if (capacity - slot(src) < n) n = capacity - slot(src);
+                        if (capacity - slot(dst) < n) n = capacity - slot(dst);
+                        memmove(at(dst), at(src), n * elem_size);
+                        dst += n;
+                        src += n;
+                        count -= n;
+                    }
+                } else if (dst > src) {
+                    while (count) {
+                        size_t n = count;
+                        if (slot(src + count - 1) + 1 < n) n = slot(src + count - 1) + 1;
+                        if (slot(dst + count - 1) + 1 < n) n = slot(dst + count - 1) + 1;
+                        count -= n;
+                        memmove(at(dst + count), at(src + count), n * elem_size);
+                    }
+                }
+            }
+
+            // opens count slots at index in a ring of size elements; elements moved past the
+            // capacity are dropped. Returns the new size
+            ARX_NOINLINE size_t open(size_t size, size_t index, size_t count) const {
+                const size_t new_size = size + count < capacity ? size + count : capacity;
+                if (index + count < new_size) move(index + count, index, new_size - index - count);
+                return new_size;
+            }
+
+            // rotates the storage so that element 0 is in slot 0
+            ARX_NOINLINE void rotate_to_front() const {
+                reverse(0, head);
+                reverse(head, capacity);
+                reverse(0, capacity);
+            }
+
+        private:
+            void reverse(size_t first, size_t last) const {
+                while (first + 1 < last) {
+                    --last;
+                    unsigned char *a = elems + first * elem_size;
+                    unsigned char *b = elems + last * elem_size;
+                    for (size_t i = 0; i < elem_size; ++i) {
+                        const unsigned char tmp = a[i];
+                        a[i] = b[i];
+                        b[i] = tmp;
+                    }
+                    ++first;
+                }
+            }
+        };
+    } // namespace detail
+
+    // With N = dynamic_size, the capacity is chosen at runtime and the elements are allocated
+    // from a memory_resource (RingBuffer(capacity, resource)).
     template<typename T, size_t N>
-    class RingBuffer {
+    class RingBuffer : protected detail::container_storage<T, N>, public detail::stats_hook {
         class Iterator;
 
-        class ConstIterator {
+        using storage = detail::container_storage<T, N>;
+        using storage::elems_;
+
+        class ConstIterator : protected detail::ring_extent<N> {
             friend RingBuffer<T, N>;
 
             const T *ptr{nullptr};  // pointer to the first element
             int pos{0};
 
-            ConstIterator(const T *ptr, int pos) : ptr(ptr), pos(pos) {}
+            ConstIterator(const T *ptr, int pos, size_t extent)
+            : detail::ring_extent<N>(extent), ptr(ptr), pos(pos) {}
 
         public:
             ConstIterator() {}
 
-            ConstIterator(const ConstIterator &it) {
-                this->ptr = it.ptr;
-                this->pos = it.pos;
-            }
+            ConstIterator(const ConstIterator &it) = default;
 
-            ConstIterator(ConstIterator &&it) {
-                this->ptr = stdx::move(it.ptr);
-                this->pos = stdx::move(it.pos);
-            }
+            ConstIterator(ConstIterator &&it) = default;
 
-            ConstIterator &operator=(const ConstIterator &rhs) {
-                this->ptr = rhs.ptr;
-                this->pos = rhs.pos;
-                return *this;
-            }
+            ConstIterator &operator=(const ConstIterator &rhs) = default;
 
-            ConstIterator &operator=(ConstIterator &&rhs) {
-                this->ptr = stdx::move(rhs.ptr);
-                this->pos = stdx::move(rhs.pos);
-                return *this;
-            }
+            ConstIterator &operator=(ConstIterator &&rhs) = default;
 
             // const-like conversion ConstIterator => Iterator
             Iterator to_iterator() const {
-                return Iterator(this->ptr, this->pos);
+                return Iterator(this->ptr, this->pos, this->extent());
             }
 
         private:
-            static int pos_wrap_around(const int pos) {
+            int pos_wrap_around(const int pos) const {
+                const int n = static_cast<int>(this->extent());
+                if (n == 0) return 0;  // a runtime capacity that ran out
                 if (pos >= 0)
-                    return pos % N;
+                    return pos % n;
                 else
-                    return (N - 1) - (abs(pos + 1) % N);
+                    return (n - 1) - (abs(pos + 1) % n);
             }
 
         public:
@@ -77,7 +185,7 @@ namespace arx {
             }
 
             ConstIterator operator+(const int n) const {
-                return ConstIterator(this->ptr, this->pos + n);
+                return ConstIterator(this->ptr, this->pos + n, this->extent());
             }
 
             int operator-(const ConstIterator &rhs) const {
@@ -85,7 +193,7 @@ namespace arx {
             }
 
             ConstIterator operator-(const int n) const {
-                return ConstIterator(this->ptr, this->pos - n);
+                return ConstIterator(this->ptr, this->pos - n, this->extent());
             }
 
             ConstIterator &operator+=(const int n) {
@@ -163,10 +271,7 @@ namespace arx {
         class Iterator : public ConstIterator {
             friend RingBuffer<T, N>;
 
-            Iterator(const T *ptr, int pos) {
-                this->ptr = ptr;
-                this->pos = pos;
-            }
+            Iterator(const T *ptr, int pos, size_t extent) : ConstIterator(ptr, pos, extent) {}
 
         public:
             Iterator() = default;
@@ -187,13 +292,16 @@ namespace arx {
                 return const_cast<T *>(this->ptr) + this->index();
             }
 
+            // distance between iterators; the overloads below would hide it
+            using ConstIterator::operator-;
+
             // all inherited methods that return ConstIterator must be reimplemented
             Iterator operator+(const int n) const {
-                return Iterator(this->ptr, this->pos + n);
+                return Iterator(this->ptr, this->pos + n, this->extent());
             }
 
             Iterator operator-(const int n) const {
-                return Iterator(this->ptr, this->pos - n);
+                return Iterator(this->ptr, this->pos - n, this->extent());
             }
 
             Iterator &operator+=(const int n) {
@@ -236,7 +344,6 @@ namespace arx {
 
         friend class ConstIterator;
 
-        T queue_[N];
         int head_;
         int tail_;
 
@@ -244,59 +351,45 @@ namespace arx {
         using iterator = Iterator;
         using const_iterator = ConstIterator;
 
-        RingBuffer() : queue_(), head_(0), tail_(0) {
+        RingBuffer() : stats_hook("RingBuffer", storage::extent()), head_(0), tail_(0) {
         }
 
-        RingBuffer(std::initializer_list<T> lst) : queue_(), head_(0), tail_(0) {
+        RingBuffer(std::initializer_list<T> lst) : stats_hook("RingBuffer", storage::extent()), head_(0), tail_(0) {
             for (auto it = lst.begin(); it != lst.end(); ++it) {
                 push_back(*it);
             }
         }
 
+        // only for N = dynamic_size: capacity elements from resource (capacity 0 if it runs out)
+        RingBuffer(size_t capacity, memory_resource &resource) : storage(capacity, resource), stats_hook("RingBuffer", storage::extent()),
+                                                             head_(0), tail_(0) {
+        }
+
         // copy
         explicit RingBuffer(const RingBuffer &r)
-                : queue_(), head_(r.head_), tail_(r.tail_) {
-            const_iterator it = r.begin();
-            for (size_t i = 0; i < r.size(); ++i) {
-                int pos = it.index_with_offset(i);
-                queue_[pos] = r.queue_[pos];
-            }
+                : storage(r), stats_hook("RingBuffer", storage::extent()), head_(0), tail_(0) {
+            copy_from(r);
         }
 
         RingBuffer &operator=(const RingBuffer &r) {
-            head_ = r.head_;
-            tail_ = r.tail_;
-            const_iterator it = r.begin();
-            for (size_t i = 0; i < r.size(); ++i) {
-                int pos = it.index_with_offset(i);
-                queue_[pos] = r.queue_[pos];
-            }
+            if (this != &r) copy_from(r);
             return *this;
         }
 
         // move
-        RingBuffer(RingBuffer &&r) {
-            head_ = stdx::move(r.head_);
-            tail_ = stdx::move(r.tail_);
-            const_iterator it = r.begin();
-            for (size_t i = 0; i < r.size(); ++i) {
-                int pos = it.index_with_offset(i);
-                queue_[pos] = stdx::move(r.queue_[pos]);
-            }
+        RingBuffer(RingBuffer &&r) : stats_hook("RingBuffer", storage::extent()), head_(0), tail_(0) {
+            move_from(r);
         }
 
         RingBuffer &operator=(RingBuffer &&r) {
-            head_ = stdx::move(r.head_);
-            tail_ = stdx::move(r.tail_);
-            const_iterator it = r.begin();
-            for (size_t i = 0; i < r.size(); ++i) {
-                int pos = it.index_with_offset(i);
-                queue_[pos] = stdx::move(r.queue_[pos]);
-            }
+            if (this != &r) move_from(r);
             return *this;
         }
 
-        size_t capacity() const { return N; };
+        size_t capacity() const { return storage::extent(); };
+
+        // the resource the elements come from, nullptr for a fixed N
+        memory_resource *resource() const { return storage::resource(); }
 
         size_t size() const { return tail_ - head_; }
 
@@ -304,13 +397,52 @@ namespace arx {
         // it should point to the 1st item and have enough space for size() readings of items
         // impossible with ringbuffer - either points to the 1st item or has enough space
         // only exception when it works is when head_ pos == 0
-        const T *data() const { return reinterpret_cast<const T *>(&(queue_)); }
+        const T *data() const { return elems_; }
 
-        T *data() { return reinterpret_cast<T *>(&(queue_)); }
+        T *data() { return elems_; }
 
         bool empty() const { return tail_ == head_; }
 
-        void clear() { head_ = tail_ = 0; }
+        void clear() {
+            head_ = tail_ = 0;
+            this->stats_size(0);
+        }
+
+        // the elements in order as two contiguous pieces: from the head to the end of the storage,
+        // then the part that wrapped around to its start (empty if nothing wrapped)
+        stdx::pair<stdx::span<T>, stdx::span<T>> spans() {
+            const size_t h = empty() ? 0 : head_iterator().index();
+            const size_t n = capacity() - h < size() ? capacity() - h : size();
+            return {stdx::span<T>(elems_ + h, n), stdx::span<T>(elems_, size() - n)};
+        }
+
+        stdx::pair<stdx::span<const T>, stdx::span<const T>> spans() const {
+            const size_t h = empty() ? 0 : head_iterator().index();
+            const size_t n = capacity() - h < size() ? capacity() - h : size();
+            return {stdx::span<const T>(elems_ + h, n), stdx::span<const T>(elems_, size() - n)};
+        }
+
+        // the elements as one span. If they wrap around, the storage is rotated first so that they
+        // start at its beginning (O(capacity()), invalidates iterators); otherwise this is O(1)
+        stdx::span<T> linearize() {
+            if (empty()) return stdx::span<T>();
+            const size_t h = head_iterator().index();
+            if (h + size() > capacity()) {
+                if (shared_core) {
+                    core().rotate_to_front();
+                } else {
+                    // rotate left by h: reverse both parts, then the whole storage
+                    reverse(0, h);
+                    reverse(h, capacity());
+                    reverse(0, capacity());
+                }
+                const int len = size();
+                head_ = 0;
+                tail_ = len;
+                return stdx::span<T>(elems_, size());
+            }
+            return stdx::span<T>(elems_ + h, size());
+        }
 
         void pop() {
             pop_front();
@@ -318,18 +450,22 @@ namespace arx {
 
         void pop_front() {
             if (size() == 0) return;
+            release(get(0));
             if (size() == 1)
                 clear();
             else
                 increment_head();
+            this->stats_pop(size());
         }
 
         void pop_back() {
             if (size() == 0) return;
+            release(back());
             if (size() == 1)
                 clear();
             else
                 decrement_tail();
+            this->stats_pop(size());
         }
 
         void push(const T &data) {
@@ -337,36 +473,52 @@ namespace arx {
         }
 
         void push(T &&data) {
-            push_back(data);
+            push_back(stdx::move(data));
         }
 
         void push_back(const T &data) {
+            if (capacity() == 0) {
+                this->stats_drop();
+                return;
+            }
             get(size()) = data;
             increment_tail();
         }
 
         void push_back(T &&data) {
-            get(size()) = data;
+            if (capacity() == 0) {
+                this->stats_drop();
+                return;
+            }
+            get(size()) = stdx::move(data);
             increment_tail();
         }
 
         void push_front(const T &data) {
+            if (capacity() == 0) {
+                this->stats_drop();
+                return;
+            }
             decrement_head();
             get(0) = data;
         }
 
         void push_front(T &&data) {
+            if (capacity() == 0) {
+                this->stats_drop();
+                return;
+            }
             decrement_head();
-            get(0) = data;
+            get(0) = stdx::move(data);
         }
 
         void emplace(const T &data) { push(data); }
 
-        void emplace(T &&data) { push(data); }
+        void emplace(T &&data) { push(stdx::move(data)); }
 
         void emplace_back(const T &data) { push_back(data); }
 
-        void emplace_back(T &&data) { push_back(data); }
+        void emplace_back(T &&data) { push_back(stdx::move(data)); }
 
         const T &front() const { return get(0); }
 
@@ -380,23 +532,29 @@ namespace arx {
 
         T &operator[](size_t index) { return get(static_cast<int>(index)); }
 
-        iterator begin() { return empty() ? Iterator() : Iterator(queue_, head_); }
+        iterator begin() { return empty() ? Iterator() : Iterator(elems_, head_, capacity()); }
 
-        iterator end() { return empty() ? Iterator() : Iterator(queue_, tail_); }
+        iterator end() { return empty() ? Iterator() : Iterator(elems_, tail_, capacity()); }
 
-        const_iterator begin() const { return empty() ? ConstIterator() : ConstIterator(queue_, head_); }
+        const_iterator begin() const { return empty() ? ConstIterator() : ConstIterator(elems_, head_, capacity()); }
 
-        const_iterator end() const { return empty() ? ConstIterator() : ConstIterator(queue_, tail_); }
+        const_iterator end() const { return empty() ? ConstIterator() : ConstIterator(elems_, tail_, capacity()); }
 
         // https://en.cppreference.com/w/cpp/container/vector/erase
         iterator erase(const const_iterator &p) {
             if (!is_valid(p)) return end();
 
-            iterator it_last = end() - 1;
-            for (iterator it = p.to_iterator(); it != it_last; ++it)
-                *it = *(it + 1);
-            *it_last = T();
+            if (shared_core) {
+                const size_t i = p.raw_pos() - head_;
+                core().move(i, i + 1, size() - i - 1);
+            } else {
+                iterator it_last = end() - 1;
+                for (iterator it = p.to_iterator(); it != it_last; ++it)
+                    *it = stdx::move(*(it + 1));
+                *it_last = T();
+            }
             decrement_tail();
+            this->stats_pop(size());
             return empty() ? end() : p.to_iterator();
         }
 
@@ -434,33 +592,45 @@ namespace arx {
         }
 
         // https://en.cppreference.com/w/cpp/container/vector/insert
+        // Elements moved past the capacity are dropped; at end() the new ones are pushed back
         void insert(const const_iterator &pos, const const_iterator &first, const const_iterator &last) {
-            if (!is_valid(pos) && pos != end())
-                return;
+            insert_n(pos, first, last - first);
+        }
 
-            size_t sz = last - first;
+        void insert(const const_iterator &pos, const T *first, const T *last) {
+            insert_n(pos, first, last - first);
+        }
 
-            size_t new_sz = size() + sz;
-            if (new_sz > capacity())
-                new_sz = capacity();
+        void insert(const const_iterator &pos, const T &val) {
+            const T *ptr = &val;
+            insert(pos, ptr, ptr + 1);
+        }
 
-            iterator it = begin() + new_sz - 1;
-            while (it != pos) {
-                *it = *(it - sz);
-                --it;
-            }
-            for (size_t i = 0; i < sz; ++i) {
-                *(it + i) = *(first + i);
-                if (size() < capacity() || (it + i) == end())
-                    increment_tail();
-            }
+    private:
+        static const bool shared_core = ARX_RINGBUFFER_SHARED_CORE && stdx::is_trivially_copyable<T>::value;
+
+        detail::ring_core core() const {
+            return {reinterpret_cast<unsigned char *>(const_cast<T *>(elems_)), sizeof(T), capacity(),
+                    empty() ? 0 : static_cast<size_t>(head_iterator().index())};
         }
 
-        void insert(const const_iterator &pos, const T *first, const T *last) {
+        template<typename InputIt>
+        void insert_n(const const_iterator &pos, InputIt first, size_t sz) {
             if (!is_valid(pos) && pos != end())
                 return;
 
-            size_t sz = last - first;
+            if (pos == end()) {
+                for (size_t i = 0; i < sz; ++i) push_back(*(first + i));
+                return;
+            }
+
+            if (shared_core) {
+                const size_t index = pos.raw_pos() - head_;
+                const size_t new_sz = core().open(size(), index, sz);
+                for (size_t i = 0; i < sz && index + i < new_sz; ++i) get(index + i) = *(first + i);
+                for (size_t i = size(); i < new_sz; ++i) increment_tail();
+                return;
+            }
 
             size_t new_sz = size() + sz;
             if (new_sz > capacity())
@@ -478,44 +648,105 @@ namespace arx {
             }
         }
 
-        void insert(const const_iterator &pos, const T &val) {
-            const T *ptr = &val;
-            insert(pos, ptr, ptr + 1);
+        void copy_from(const RingBuffer &r) {
+            if (capacity() == r.capacity()) {
+                head_ = r.head_;
+                tail_ = r.tail_;
+                const_iterator it = r.begin();
+                for (size_t i = 0; i < r.size(); ++i) {
+                    int pos = it.index_with_offset(i);
+                    elems_[pos] = r.elems_[pos];
+                }
+                this->stats_size(size());
+            } else {
+                // different runtime capacities: the newest elements that fit are kept
+                clear();
+                for (size_t i = 0; i < r.size(); ++i) push_back(r[i]);
+            }
+        }
+
+        void move_from(RingBuffer &r) {
+            if (storage::take(r)) {
+                // dynamic storage: the buffers were swapped, r is left with this one's old buffer
+                head_ = r.head_;
+                tail_ = r.tail_;
+                r.clear();
+                this->stats_capacity(capacity());
+                this->stats_size(size());
+                r.stats_capacity(r.capacity());
+                return;
+            }
+            head_ = stdx::move(r.head_);
+            tail_ = stdx::move(r.tail_);
+            const_iterator it = r.begin();
+            for (size_t i = 0; i < r.size(); ++i) {
+                int pos = it.index_with_offset(i);
+                elems_[pos] = stdx::move(r.elems_[pos]);
+            }
+            this->stats_size(size());
+        }
+
+        void reverse(size_t first, size_t last) {
+            while (first + 1 < last) {
+                --last;
+                T tmp = stdx::move(elems_[first]);
+                elems_[first] = stdx::move(elems_[last]);
+                elems_[last] = stdx::move(tmp);
+                ++first;
+            }
+        }
+
+        // popped slots of non-trivial types are reset, so that resources they own
+        // (a String buffer, a callable in a unique_function) are released right away
+        static void release(T &slot) {
+            if (!stdx::is_trivially_copyable<T>::value) slot = T();
         }
 
-    private:
         T &get(const iterator &it) {
-            return queue_[it.index()];
+            return elems_[it.index()];
         }
 
         const T &get(const const_iterator &it) const {
-            return queue_[it.index()];
+            return elems_[it.index()];
         }
 
+        // not begin(): it is a default iterator without the capacity while the buffer is empty
         T &get(const int index) {
-            return queue_[begin().index_with_offset(index)];
+            if (capacity() == 0) return no_element();
+            return elems_[head_iterator().index_with_offset(index)];
         }
 
         const T &get(const int index) const {
-            return queue_[begin().index_with_offset(index)];
+            if (capacity() == 0) return no_element();
+            return elems_[head_iterator().index_with_offset(index)];
+        }
+
+        // front(), back() and [] of a container without storage (a runtime capacity that ran out):
+        // a fresh T every time, as map::at() returns for a missing key
+        static T &no_element() {
+            static T val;
+            val = T();
+            return val;
         }
 
         T *ptr(const iterator &it) {
-            return queue_ + it.index();
+            return elems_ + it.index();
         }
 
         const T *ptr(const const_iterator &it) const {
-            return queue_ + it.index();
+            return elems_ + it.index();
         }
 
         T *ptr(const int index) {
-            return queue_ + begin().index_with_offset(index);
+            return elems_ + head_iterator().index_with_offset(index);
         }
 
         const T *ptr(const int index) const {
-            return queue_ + begin().index_with_offset(index);
+            return elems_ + head_iterator().index_with_offset(index);
         }
 
+        const_iterator head_iterator() const { return ConstIterator(elems_, head_, capacity()); }
+
         void increment_head() {
             ++head_;
             resolve_overflow();
@@ -524,15 +755,23 @@ namespace arx {
         void increment_tail() {
             ++tail_;
             resolve_overflow();
-            if (size() > N)
+            if (size() > capacity()) {
+                // the oldest element is overwritten
+                this->stats_overwrite();
                 increment_head();
+            }
+            this->stats_push(size());
         }
 
         void decrement_head() {
             --head_;
             resolve_overflow();
-            if (size() > N)
+            if (size() > capacity()) {
+                // the last element is pushed out
+                this->stats_overwrite();
                 decrement_tail();
+            }
+            this->stats_push(size());
         }
 
         void decrement_tail() {
@@ -546,7 +785,7 @@ namespace arx {
             else if (head_ <= (static_cast<int>(INT_MIN) + static_cast<int>(capacity())) \
  || tail_ >= (static_cast<int>(INT_MAX) - static_cast<int>(capacity()))) {
                 // +/- capacity(): reserve some space for pointer/iterator arithmetics
-                // head_/tail_ pointers are re-set N+1 steps before the overflow occurs
+                // head_/tail_ pointers are re-set capacity()+1 steps before the overflow occurs
                 int len = size();
                 head_ = begin().index();
                 tail_ = head_ + len;
@@ -554,7 +793,7 @@ namespace arx {
         }
 
         bool is_valid(const const_iterator &it) const {
-            if (it.ptr != queue_)
+            if (it.ptr != elems_)
                 return false; // iterator to a different object
             return (it.raw_pos() >= head_) && (it.raw_pos() < tail_);
         }
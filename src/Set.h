@@ -10,83 +10,213 @@
 #ifdef ARDUINO
     #include <Arduino.h>
 #endif
+#include <stdlib.h>
+#include <string.h>
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
 #include "ArxContainer.h"
+#include "Functional.h"
+#include "Move.h"
+#include "TypeTraits.h"
+#include "MemoryResource.h"
+#include "ContainerStats.h"
 
 namespace arx {
     namespace stdx {
 
-        template<typename T, size_t N = ARX_SET_DEFAULT_SIZE>
-        class set {
+        namespace detail {
+            struct set_ops;
+        }
+
+        // With N = dynamic_size, the capacity is chosen at runtime and the elements are allocated
+        // from a memory_resource (set(capacity, resource)).
+        template<typename T, size_t N = ARX_SET_DEFAULT_SIZE, typename Compare = less<T>>
+        class set : private ::arx::detail::container_storage<T, N>, public ::arx::detail::stats_hook {
+            template<typename, size_t, typename>
+            friend class set;
+
+            friend struct detail::set_ops;
+
         private:
-            T data[N];
-            size_t count;
+            using storage = ::arx::detail::container_storage<T, N>;
+            using storage::elems_;
+
+            size_t count_;
+
+            // bulk inserts are merged in chunks of this many elements, kept on the stack
+            static const size_t BATCH = (N != dynamic_size && N < 16) ? N : 16;
+
+            // Heterogeneous overloads are only available with a transparent Compare (e.g. less<>)
+            template<typename K>
+            using EnableIfTransparent = typename enable_if<
+                    is_transparent<Compare>::value && !is_same<K, T>::value
+            >::type;
 
         public:
-            set() : count(0) {}
+            set() : stats_hook("set", storage::extent()), count_(0) {}
 
-            set(std::initializer_list<T> lst) : count(0) {
-                for (const auto &item: lst) insert(item);
+            set(std::initializer_list<T> lst) : stats_hook("set", storage::extent()), count_(0) {
+                insert(lst.begin(), lst.end());
             }
 
-            ~set() { clear(); }
+            // only for N = dynamic_size: capacity elements from resource (capacity 0 if it runs out)
+            set(size_t capacity, memory_resource &resource) : storage(capacity, resource), stats_hook("set", storage::extent()), count_(0) {}
+
+            set(const set &r) : storage(r), stats_hook("set", storage::extent()), count_(0) {
+                copy_from(r);
+            }
+
+            set &operator=(const set &r) {
+                if (this != &r) copy_from(r);
+                return *this;
+            }
+
+            set(set &&r) : stats_hook("set", storage::extent()), count_(0) {
+                move_from(r);
+            }
+
+            set &operator=(set &&r) {
+                if (this != &r) move_from(r);
+                return *this;
+            }
+
+            size_t capacity() const { return storage::extent(); }
+
+            // the resource the elements come from, nullptr for a fixed N
+            memory_resource *resource() const { return storage::resource(); }
 
             bool insert(const T &data_) {
-                if (count >= N || exist(data_)) return false;
-                size_t low = binary(data_);
-                // Insert and shift elements
-                data[count++] = data_;
-                for (size_t i = count - 1; i > low; i--) {
-                    data[i] = data[i - 1];
+                if (count_ >= capacity()) {
+                    this->stats_drop();
+                    return false;
                 }
-                data[low] = data_;
+                size_t low = binary(data_);
+                if (low < count_ && !Compare()(data_, elems_[low])) return false;
+                // Shift elements right and insert
+                shift_right(low, 1);
+                elems_[low] = data_;
+                ++count_;
+                this->stats_push(count_);
                 return true;
             }
 
+            // Bulk insert: the batch is read in chunks of up to 16 (BATCH) elements, each sorted and merged
+            // with the current elements in a single pass instead of one O(N) insert per element.
+            // When the set fills up, the largest new elements of the chunk are dropped.
+            template<typename InputIt>
+            void insert(InputIt first, InputIt last) {
+                T batch[BATCH];
+                while (first != last && count_ < capacity()) {
+                    size_t n = 0;
+                    while (first != last && n < BATCH) batch[n++] = *first++;
+                    merge_batch(batch, n);
+                }
+#if ARX_CONTAINER_STATS
+                // input left over once the set is full
+                for (; first != last; ++first) this->stats_drop();
+#endif
+            }
+
             T &any() {
-                return data[random(count)];
+#ifdef ARDUINO
+                return elems_[random(count_)];
+#else
+                return elems_[rand() % count_];
+#endif
             }
 
             bool erase(const T &data_) {
-                int idx = index(data_);
+                return erase_at(index(data_));
+            }
+
+            template<typename K, typename = EnableIfTransparent<K>>
+            bool erase(const K &key) {
+                return erase_at(index(key));
+            }
+
+        private:
+            bool erase_at(int idx) {
                 if (idx == -1) return false;
                 // Shift elements left
-                for (size_t i = idx; i < count - 1; i++) {
-                    (*this)[i] = (*this)[i + 1];
-                }
-                --count;
+                shift_left(idx + 1, 1);
+                --count_;
+                release(count_, count_ + 1);
+                this->stats_pop(count_);
                 return true;
             }
 
+        public:
             void clear() {
-                for (size_t i = 0; i < count; i++) {
-                    data[i].~T();
-                }
-                count = 0;
+                release(0, count_);
+                count_ = 0;
+                this->stats_size(0);
             }
 
             size_t size() const {
-                return count;
+                return count_;
+            }
+
+            // the elements in ascending order, contiguous (so a set converts to span<const T>)
+            const T *data() const {
+                return elems_;
             }
 
             bool empty() const {
-                return count == 0;
+                return count_ == 0;
             }
 
             bool exist(const T &data_) const {
                 return index(data_) != -1;
             }
 
-            T *begin() { return data; }
+            template<typename K, typename = EnableIfTransparent<K>>
+            bool exist(const K &key) const {
+                return index(key) != -1;
+            }
+
+            size_t count(const T &data_) const {
+                return exist(data_) ? 1 : 0;
+            }
 
-            T *end() { return data + count; }
+            template<typename K, typename = EnableIfTransparent<K>>
+            size_t count(const K &key) const {
+                return exist(key) ? 1 : 0;
+            }
+
+            T *find(const T &data_) {
+                int idx = index(data_);
+                return idx == -1 ? end() : elems_ + idx;
+            }
 
-            const T *begin() const { return data; }
+            const T *find(const T &data_) const {
+                int idx = index(data_);
+                return idx == -1 ? end() : elems_ + idx;
+            }
 
-            const T *end() const { return data + count; }
+            template<typename K, typename = EnableIfTransparent<K>>
+            T *find(const K &key) {
+                int idx = index(key);
+                return idx == -1 ? end() : elems_ + idx;
+            }
+
+            template<typename K, typename = EnableIfTransparent<K>>
+            const T *find(const K &key) const {
+                int idx = index(key);
+                return idx == -1 ? end() : elems_ + idx;
+            }
+
+            T *begin() { return elems_; }
+
+            T *end() { return elems_ + count_; }
+
+            const T *begin() const { return elems_; }
+
+            const T *end() const { return elems_ + count_; }
 
             friend bool operator==(const set &a, const set &b) {
-                if (a.count != b.count) return false;
-                for (size_t i = 0; i < a.count; i++) {
+                if (a.count_ != b.count_) return false;
+                for (size_t i = 0; i < a.count_; i++) {
                     if (a[i] != b[i]) return false;
                 }
                 return true;
@@ -96,11 +226,28 @@ namespace arx {
                 return !(a == b);
             }
 
+            // In-place set algebra against another sorted set, O(n + m).
+            // Elements that don't fit in the capacity are dropped (largest first).
+            template<size_t M>
+            set &operator|=(const set<T, M, Compare> &r) {
+                merge_sorted(r.elems_, r.count_);
+                return *this;
+            }
+
+            template<size_t M>
+            set &operator&=(const set<T, M, Compare> &r);
+
+            template<size_t M>
+            set &operator-=(const set<T, M, Compare> &r);
+
+            template<size_t M>
+            set &operator^=(const set<T, M, Compare> &r);
+
             friend bool operator<(const set &a, const set &b) {
-                if (a.count != b.count) return a.count < b.count;
+                if (a.count_ != b.count_) return a.count_ < b.count_;
 
                 // If sizes are equal, compare elements
-                for (size_t i = 0; i < a.count; i++) {
+                for (size_t i = 0; i < a.count_; i++) {
                     if (a[i] < b[i]) return true;
                     if (b[i] < a[i]) return false;
                 }
@@ -108,35 +255,449 @@ namespace arx {
             }
 
         private:
-            int index(const T &data_) const {
-                size_t low = binary(data_);
-                return (low < count && (*this)[low] == data_) ? low : -1;
+            template<typename K>
+            int index(const K &key) const {
+                size_t low = binary(key);
+                return (low < count_ && !Compare()(key, (*this)[low])) ? low : -1;
             }
 
-            int binary(const T &data_) const {
+            template<typename K>
+            size_t binary(const K &key) const {
                 // Find position using binary search
                 size_t low = 0;
-                size_t high = count;
+                size_t high = count_;
+                size_t probes = 0;
                 while (low < high) {
                     size_t mid = (low + high) / 2;
-                    if ((*this)[mid] < data_) {
+                    ++probes;
+                    if (Compare()((*this)[mid], key)) {
                         low = mid + 1;
                     } else {
                         high = mid;
                     }
                 }
+                this->stats_lookup(probes);
                 return low;
             }
 
-            T operator[](size_t index) const {
-                return data[index];
+            const T &operator[](size_t index) const {
+                return elems_[index];
             }
 
             T &operator[](size_t index) {
-                return data[index];
+                return elems_[index];
+            }
+
+            static const bool trivial = is_trivially_copyable<T>::value;
+
+            // an empty set with the same capacity (and resource) as r
+            struct like_tag {};
+
+            set(like_tag, const set &r) : storage(r), stats_hook("set", storage::extent()), count_(0) {}
+
+            void copy_from(const set &r) {
+                const size_t n = r.count_ < capacity() ? r.count_ : capacity();
+                for (size_t i = 0; i < n; ++i) elems_[i] = r.elems_[i];
+                release(n, count_);
+                count_ = n;
+                this->stats_size(count_);
+            }
+
+            void move_from(set &r) {
+                if (storage::take(r)) {
+                    // dynamic storage: the buffers were swapped, r is left with this one's old buffer
+                    const size_t n = count_;
+                    count_ = r.count_;
+                    r.count_ = n;
+                    r.clear();
+                    this->stats_capacity(capacity());
+                    this->stats_size(count_);
+                    r.stats_capacity(r.capacity());
+                    return;
+                }
+                const size_t n = r.count_ < capacity() ? r.count_ : capacity();
+                for (size_t i = 0; i < n; ++i) elems_[i] = stdx::move(r.elems_[i]);
+                release(n, count_);
+                count_ = n;
+                this->stats_size(count_);
+                r.clear();
+            }
+
+            // move [from, count_) to [from + n, count_ + n)
+            void shift_right(size_t from, size_t n) {
+                if (trivial) {
+                    memmove(static_cast<void *>(elems_ + from + n), static_cast<const void *>(elems_ + from), (count_ - from) * sizeof(T));
+                } else {
+                    for (size_t i = count_; i > from; --i) elems_[i + n - 1] = stdx::move(elems_[i - 1]);
+                }
+            }
+
+            // move [from, count_) to [from - n, count_ - n)
+            void shift_left(size_t from, size_t n) {
+                if (trivial) {
+                    memmove(static_cast<void *>(elems_ + from - n), static_cast<const void *>(elems_ + from), (count_ - from) * sizeof(T));
+                } else {
+                    for (size_t i = from; i < count_; ++i) elems_[i - n] = stdx::move(elems_[i]);
+                }
+            }
+
+            // reset unused slots so that e.g. String releases its heap buffer
+            void release(size_t from, size_t to) {
+                if (trivial) return;
+                for (size_t i = from; i < to; ++i) elems_[i] = T();
+            }
+
+            void merge_batch(T *batch, size_t n) {
+                sort_batch(batch, n);
+
+                // drop duplicates inside the batch
+                size_t k = 0;
+                for (size_t i = 0; i < n; ++i) {
+                    if (k == 0 || Compare()(batch[k - 1], batch[i])) {
+                        if (k != i) batch[k] = stdx::move(batch[i]);
+                        ++k;
+                    }
+                }
+
+                merge_sorted(batch, k);
+            }
+
+            // merges a sorted, duplicate-free range that does not alias elems_
+            template<typename Src>
+            void merge_sorted(Src *src, size_t k) {
+                // count new elements (forward pass), dropping the largest ones that don't fit
+                size_t a = 0, b = 0, fresh = 0;
+                while (b < k) {
+                    if (a < count_ && Compare()(elems_[a], src[b])) {
+                        ++a;
+                    } else if (a < count_ && !Compare()(src[b], elems_[a])) {
+                        ++a;
+                        ++b;
+                    } else {
+                        if (count_ + fresh == capacity()) {
+                            this->stats_drop(k - b);  // the rest of src does not fit
+                            break;
+                        }
+                        ++fresh;
+                        ++b;
+                    }
+                }
+                k = b;
+                if (fresh == 0) return;
+
+                // backward merge: src lives outside elems_, so nothing is overwritten before it's read
+                size_t i = count_, j = k, w = count_ + fresh;
+                while (j > 0 && w > i) {
+                    if (i > 0 && Compare()(src[j - 1], elems_[i - 1])) {
+                        elems_[--w] = stdx::move(elems_[--i]);
+                    } else if (i > 0 && !Compare()(elems_[i - 1], src[j - 1])) {
+                        --j;  // already present
+                    } else {
+                        elems_[--w] = stdx::move(src[--j]);
+                    }
+                }
+                count_ += fresh;
+                this->stats_size(count_);
+            }
+
+            static void sort_batch(T *p, size_t n) {
+                if (n <= 16) {
+                    // insertion sort for the small batches typical on MCUs
+                    for (size_t i = 1; i < n; ++i) {
+                        T v = stdx::move(p[i]);
+                        size_t j = i;
+                        for (; j > 0 && Compare()(v, p[j - 1]); --j) p[j] = stdx::move(p[j - 1]);
+                        p[j] = stdx::move(v);
+                    }
+                    return;
+                }
+                // heap sort keeps the worst case at O(n log n) without extra memory
+                for (size_t i = n / 2; i > 0; --i) sift_down(p, i - 1, n);
+                for (size_t end = n - 1; end > 0; --end) {
+                    T tmp = stdx::move(p[0]);
+                    p[0] = stdx::move(p[end]);
+                    p[end] = stdx::move(tmp);
+                    sift_down(p, 0, end);
+                }
+            }
+
+            static void sift_down(T *p, size_t root, size_t n) {
+                for (;;) {
+                    size_t child = root * 2 + 1;
+                    if (child >= n) return;
+                    if (child + 1 < n && Compare()(p[child], p[child + 1])) ++child;
+                    if (!Compare()(p[root], p[child])) return;
+                    T tmp = stdx::move(p[root]);
+                    p[root] = stdx::move(p[child]);
+                    p[child] = stdx::move(tmp);
+                    root = child;
+                }
             }
         };
+
+        namespace detail {
+#if defined(__SSE2__)
+            // lane-wise equality of 8- and 16-bit integers
+            template<size_t Size>
+            struct simd_lanes;
+
+            template<>
+            struct simd_lanes<1> {
+                static __m128i eq(__m128i a, __m128i b) { return _mm_cmpeq_epi8(a, b); }
+            };
+
+            template<>
+            struct simd_lanes<2> {
+                static __m128i eq(__m128i a, __m128i b) { return _mm_cmpeq_epi16(a, b); }
+            };
+
+            // lanes of va equal to any lane of vb, vb rotated by one more lane each step (SSE2 has no
+            // variable shuffle for bytes, so rotations are pairs of whole-register shifts)
+            template<size_t Size, size_t Rotations>
+            struct simd_any_equal {
+                static __m128i run(__m128i va, __m128i vb) {
+                    const __m128i rotated = _mm_or_si128(_mm_srli_si128(vb, Rotations * Size),
+                                                         _mm_slli_si128(vb, 16 - Rotations * Size));
+                    return _mm_or_si128(simd_any_equal<Size, Rotations - 1>::run(va, vb),
+                                        simd_lanes<Size>::eq(va, rotated));
+                }
+            };
+
+            template<size_t Size>
+            struct simd_any_equal<Size, 0> {
+                static __m128i run(__m128i va, __m128i vb) { return simd_lanes<Size>::eq(va, vb); }
+            };
+#endif
+
+            // Linear merges over the sorted elems_ arrays of set.
+            // Each writes at most cap elements to out and returns the size of the full result,
+            // so a return value above cap means the result was truncated.
+            // out may alias a for intersection and difference (writes never overtake reads).
+            struct set_ops {
+                template<typename T, typename C>
+                static size_t unite(const T *a, size_t na, const T *b, size_t nb, T *out, size_t cap) {
+                    size_t i = 0, j = 0, w = 0;
+                    while (i < na || j < nb) {
+                        if (j == nb || (i < na && C()(a[i], b[j]))) emit(out, w, cap, a[i++]);
+                        else if (i == na || C()(b[j], a[i])) emit(out, w, cap, b[j++]);
+                        else {
+                            emit(out, w, cap, a[i++]);
+                            ++j;
+                        }
+                    }
+                    return w;
+                }
+
+                template<typename T, typename C>
+                static size_t intersect(const T *a, size_t na, const T *b, size_t nb, T *out, size_t cap) {
+                    return intersect_dispatch<T, C>(a, na, b, nb, out, cap, 0);
+                }
+
+                template<typename T, typename C>
+                static size_t subtract(const T *a, size_t na, const T *b, size_t nb, T *out, size_t cap) {
+                    size_t i = 0, j = 0, w = 0;
+                    while (i < na) {
+                        if (j == nb || C()(a[i], b[j])) emit(out, w, cap, a[i++]);
+                        else if (C()(b[j], a[i])) ++j;
+                        else {
+                            ++i;
+                            ++j;
+                        }
+                    }
+                    return w;
+                }
+
+                template<typename T, typename C>
+                static size_t symmetric(const T *a, size_t na, const T *b, size_t nb, T *out, size_t cap) {
+                    size_t i = 0, j = 0, w = 0;
+                    while (i < na || j < nb) {
+                        if (j == nb || (i < na && C()(a[i], b[j]))) emit(out, w, cap, a[i++]);
+                        else if (i == na || C()(b[j], a[i])) emit(out, w, cap, b[j++]);
+                        else {
+                            ++i;
+                            ++j;
+                        }
+                    }
+                    return w;
+                }
+
+                // true if every element of b is in a
+                template<typename T, typename C>
+                static bool includes(const T *a, size_t na, const T *b, size_t nb) {
+                    if (nb > na) return false;
+                    size_t i = 0;
+                    for (size_t j = 0; j < nb; ++j) {
+                        while (i < na && C()(a[i], b[j])) ++i;
+                        if (i == na || C()(b[j], a[i])) return false;
+                        ++i;
+                    }
+                    return true;
+                }
+
+                // out = op(a, b), returns false if the result did not fit
+                template<typename T, size_t N1, size_t N2, size_t N3, typename C>
+                static bool into(size_t (*op)(const T *, size_t, const T *, size_t, T *, size_t),
+                                 const set<T, N1, C> &a, const set<T, N2, C> &b, set<T, N3, C> &out) {
+                    out.clear();
+                    const size_t cap = out.capacity();
+                    size_t n = op(a.elems_, a.count_, b.elems_, b.count_, out.elems_, cap);
+                    out.count_ = n < cap ? n : cap;
+                    out.stats_size(out.count_);
+                    return n <= cap;
+                }
+
+                // a = op(a, b) for the operations that can run in place
+                template<typename T, size_t N1, size_t N2, typename C>
+                static void in_place(size_t (*op)(const T *, size_t, const T *, size_t, T *, size_t),
+                                     set<T, N1, C> &a, const set<T, N2, C> &b) {
+                    size_t n = op(a.elems_, a.count_, b.elems_, b.count_, a.elems_, a.capacity());
+                    a.release(n, a.count_);
+                    a.count_ = n;
+                    a.stats_size(n);
+                }
+
+                template<typename T, size_t N1, size_t N2, typename C>
+                static bool includes(const set<T, N1, C> &a, const set<T, N2, C> &b) {
+                    return includes<T, C>(a.elems_, a.count_, b.elems_, b.count_);
+                }
+
+            private:
+                template<typename T>
+                static void emit(T *out, size_t &w, size_t cap, const T &v) {
+                    if (w < cap) out[w] = v;
+                    ++w;
+                }
+
+                template<typename T, typename C>
+                static size_t intersect_scalar(const T *a, size_t na, const T *b, size_t nb, T *out, size_t cap,
+                                               size_t i, size_t j, size_t w) {
+                    while (i < na && j < nb) {
+                        if (C()(a[i], b[j])) ++i;
+                        else if (C()(b[j], a[i])) ++j;
+                        else {
+                            emit(out, w, cap, a[i++]);
+                            ++j;
+                        }
+                    }
+                    return w;
+                }
+
+                template<typename T, typename C>
+                static size_t intersect_dispatch(const T *a, size_t na, const T *b, size_t nb, T *out, size_t cap, ...) {
+                    return intersect_scalar<T, C>(a, na, b, nb, out, cap, 0, 0, 0);
+                }
+
+#if defined(__SSE2__)
+                // 4x4 all-pairs block compare for 32-bit integers ordered by less<T>
+                template<typename T, typename C>
+                static typename enable_if<
+                        is_integral<T>::value && sizeof(T) == 4 && is_same<C, less<T>>::value, size_t
+                >::type
+                intersect_dispatch(const T *a, size_t na, const T *b, size_t nb, T *out, size_t cap, int) {
+                    size_t i = 0, j = 0, w = 0;
+                    while (i + 4 <= na && j + 4 <= nb && w + 4 <= cap) {
+                        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+                        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + j));
+                        __m128i eq = _mm_or_si128(
+                                _mm_or_si128(_mm_cmpeq_epi32(va, vb),
+                                             _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1)))),
+                                _mm_or_si128(_mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))),
+                                             _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3)))));
+                        const int mask = _mm_movemask_ps(_mm_castsi128_ps(eq));
+                        for (size_t k = 0; k < 4; ++k)
+                            if (mask & (1 << k)) out[w++] = a[i + k];
+                        const T amax = a[i + 3];
+                        const T bmax = b[j + 3];
+                        if (!(bmax < amax)) i += 4;
+                        if (!(amax < bmax)) j += 4;
+                    }
+                    return intersect_scalar<T, C>(a, na, b, nb, out, cap, i, j, w);
+                }
+
+                // 16x16 (8-bit) or 8x8 (16-bit) all-pairs block compare, e.g. for sets of channel ids
+                template<typename T, typename C>
+                static typename enable_if<
+                        is_integral<T>::value && (sizeof(T) == 1 || sizeof(T) == 2) && is_same<C, less<T>>::value,
+                        size_t
+                >::type
+                intersect_dispatch(const T *a, size_t na, const T *b, size_t nb, T *out, size_t cap, int) {
+                    static const size_t LANES = 16 / sizeof(T);
+                    size_t i = 0, j = 0, w = 0;
+                    while (i + LANES <= na && j + LANES <= nb && w + LANES <= cap) {
+                        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+                        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + j));
+                        // one mask bit per byte: lane k of a is found if bit k * sizeof(T) is set
+                        const int mask = _mm_movemask_epi8(simd_any_equal<sizeof(T), LANES - 1>::run(va, vb));
+                        for (size_t k = 0; k < LANES; ++k)
+                            if (mask & (1 << (k * sizeof(T)))) out[w++] = a[i + k];
+                        const T amax = a[i + LANES - 1];
+                        const T bmax = b[j + LANES - 1];
+                        if (!(bmax < amax)) i += LANES;
+                        if (!(amax < bmax)) j += LANES;
+                    }
+                    return intersect_scalar<T, C>(a, na, b, nb, out, cap, i, j, w);
+                }
+#endif
+            };
+        } // namespace detail
+
+        template<typename T, size_t N, typename C>
+        template<size_t M>
+        set<T, N, C> &set<T, N, C>::operator&=(const set<T, M, C> &r) {
+            detail::set_ops::in_place(&detail::set_ops::intersect<T, C>, *this, r);
+            return *this;
+        }
+
+        template<typename T, size_t N, typename C>
+        template<size_t M>
+        set<T, N, C> &set<T, N, C>::operator-=(const set<T, M, C> &r) {
+            detail::set_ops::in_place(&detail::set_ops::subtract<T, C>, *this, r);
+            return *this;
+        }
+
+        template<typename T, size_t N, typename C>
+        template<size_t M>
+        set<T, N, C> &set<T, N, C>::operator^=(const set<T, M, C> &r) {
+            // the result interleaves both inputs, so it's built aside and moved back
+            set tmp(typename set::like_tag(), *this);
+            detail::set_ops::into(&detail::set_ops::symmetric<T, C>, *this, r, tmp);
+            *this = stdx::move(tmp);
+            return *this;
+        }
+
+        // Output variants, O(n + m) over the sorted elems_: out is overwritten with the result
+        // and must not alias a or b. They return false if the result was truncated to out's capacity.
+        template<typename T, size_t N1, size_t N2, size_t N3, typename C>
+        bool set_union(const set<T, N1, C> &a, const set<T, N2, C> &b, set<T, N3, C> &out) {
+            return detail::set_ops::into(&detail::set_ops::unite<T, C>, a, b, out);
+        }
+
+        template<typename T, size_t N1, size_t N2, size_t N3, typename C>
+        bool set_intersection(const set<T, N1, C> &a, const set<T, N2, C> &b, set<T, N3, C> &out) {
+            return detail::set_ops::into(&detail::set_ops::intersect<T, C>, a, b, out);
+        }
+
+        template<typename T, size_t N1, size_t N2, size_t N3, typename C>
+        bool set_difference(const set<T, N1, C> &a, const set<T, N2, C> &b, set<T, N3, C> &out) {
+            return detail::set_ops::into(&detail::set_ops::subtract<T, C>, a, b, out);
+        }
+
+        template<typename T, size_t N1, size_t N2, size_t N3, typename C>
+        bool set_symmetric_difference(const set<T, N1, C> &a, const set<T, N2, C> &b, set<T, N3, C> &out) {
+            return detail::set_ops::into(&detail::set_ops::symmetric<T, C>, a, b, out);
+        }
+
+        // true if every element of b is also in a
+        template<typename T, size_t N1, size_t N2, typename C>
+        bool includes(const set<T, N1, C> &a, const set<T, N2, C> &b) {
+            return detail::set_ops::includes(a, b);
+        }
     } //  namespace stdx
+
+    namespace pmr {
+        template<typename T, typename Compare = stdx::less<T>>
+        using set = stdx::set<T, dynamic_size, Compare>;
+    } // namespace pmr
 } // namespace arx
 
 #endif //ARX_SET_H
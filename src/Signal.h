@@ -0,0 +1,226 @@
+#pragma once
+
+#ifndef ARX_SIGNAL_H
+#define ARX_SIGNAL_H
+
+#ifndef ARX_SIGNAL_DEFAULT_SLOTS
+#define ARX_SIGNAL_DEFAULT_SLOTS 8
+#endif  // ARX_SIGNAL_DEFAULT_SLOTS
+
+#ifndef ARX_SIGNAL_DEFAULT_PENDING
+#define ARX_SIGNAL_DEFAULT_PENDING 8
+#endif  // ARX_SIGNAL_DEFAULT_PENDING
+
+#include <stdint.h>
+#include "ArxContainer.h"
+#include "RingBuffer.h"
+#include "TypeTraits.h"
+
+namespace arx {
+
+    namespace detail {
+        template<size_t...>
+        struct index_sequence {};
+
+        template<size_t N, size_t... Is>
+        struct make_index_sequence : make_index_sequence<N - 1, N - 1, Is...> {};
+
+        template<size_t... Is>
+        struct make_index_sequence<0, Is...> {
+            typedef index_sequence<Is...> type;
+        };
+
+        template<size_t I, typename T>
+        struct pack_leaf {
+            T value;
+        };
+
+        template<size_t I, typename T>
+        T &pack_get(pack_leaf<I, T> &leaf) { return leaf.value; }
+
+        template<typename Seq, typename... Ts>
+        struct value_pack_impl;
+
+        template<size_t... Is, typename... Ts>
+        struct value_pack_impl<index_sequence<Is...>, Ts...> : pack_leaf<Is, Ts> ... {
+            value_pack_impl() = default;
+
+            template<typename... Us>
+            explicit value_pack_impl(Us &&... us) : pack_leaf<Is, Ts>{static_cast<Us &&>(us)}... {}
+        };
+
+        // stored copy of a set of call arguments, used to queue events
+        template<typename... Ts>
+        using value_pack = value_pack_impl<typename make_index_sequence<sizeof...(Ts)>::type, Ts...>;
+    } // namespace detail
+
+    template<typename Signature, size_t Slots = ARX_SIGNAL_DEFAULT_SLOTS, size_t Pending = ARX_SIGNAL_DEFAULT_PENDING>
+    class signal;
+
+    // Fixed-capacity signal/slot dispatcher.
+    // connect()/disconnect() are O(1) through generation-checked handles. Slots may be connected
+    // or disconnected from inside a handler: the change takes effect once the outermost emit() returns,
+    // and a slot disconnected during emission is not called again.
+    // post() queues the arguments in a RingBuffer and flush() emits all queued events in one pass.
+    template<typename... Args, size_t Slots, size_t Pending>
+    class signal<void(Args...), Slots, Pending> {
+        static_assert(Slots > 0 && Slots < 0xFFFF, "signal slot count must fit in 16-bit indices");
+
+        using index_t = uint16_t;
+        static const index_t NIL = 0xFFFF;
+
+        enum State : uint8_t { FREE, ACTIVE, ADDED, REMOVED };
+
+        using event_t = detail::value_pack<typename stdx::remove_cvref<Args>::type...>;
+        using sequence_t = typename detail::make_index_sequence<sizeof...(Args)>::type;
+
+    public:
+        using slot_type = stdx::function<void(Args...)>;
+
+        struct connection {
+            index_t index{NIL};
+            index_t generation{0};
+
+            bool valid() const { return index != NIL; }
+        };
+
+    private:
+        slot_type slots_[Slots];
+        index_t generation_[Slots];
+        index_t next_free_[Slots];
+        uint8_t state_[Slots];
+        index_t free_;
+        index_t used_;  // slots at or above this index have never been handed out
+        index_t active_;
+        uint8_t emitting_;
+        bool dirty_;
+        RingBuffer<event_t, Pending> pending_;
+
+    public:
+        signal() : free_(0), used_(0), active_(0), emitting_(0), dirty_(false) {
+            for (size_t i = 0; i < Slots; ++i) {
+                generation_[i] = 0;
+                state_[i] = FREE;
+                next_free_[i] = static_cast<index_t>(i + 1 < Slots ? i + 1 : NIL);
+            }
+        }
+
+        signal(const signal &) = delete;
+
+        signal &operator=(const signal &) = delete;
+
+        // returns an invalid connection if all slots are taken
+        connection connect(slot_type slot) {
+            connection c;
+            if (free_ == NIL || !slot) return c;
+            const index_t i = free_;
+            free_ = next_free_[i];
+            slots_[i] = stdx::move(slot);
+            if (emitting_) {
+                state_[i] = ADDED;
+                dirty_ = true;
+            } else {
+                state_[i] = ACTIVE;
+            }
+            if (i >= used_) used_ = i + 1;
+            ++active_;
+            c.index = i;
+            c.generation = generation_[i];
+            return c;
+        }
+
+        bool disconnect(connection &c) {
+            if (!connected(c)) return false;
+            const index_t i = c.index;
+            ++generation_[i];
+            --active_;
+            if (emitting_) {
+                // the slot may be running right now, so it's destroyed after emission
+                state_[i] = REMOVED;
+                dirty_ = true;
+            } else {
+                release(i);
+            }
+            c = connection();
+            return true;
+        }
+
+        bool connected(const connection &c) const {
+            return c.index < Slots && generation_[c.index] == c.generation &&
+                   (state_[c.index] == ACTIVE || state_[c.index] == ADDED);
+        }
+
+        void disconnect_all() {
+            for (index_t i = 0; i < used_; ++i) {
+                if (state_[i] == ACTIVE || state_[i] == ADDED) {
+                    connection c;
+                    c.index = i;
+                    c.generation = generation_[i];
+                    disconnect(c);
+                }
+            }
+        }
+
+        size_t size() const { return active_; }
+
+        bool empty() const { return active_ == 0; }
+
+        size_t capacity() const { return Slots; }
+
+        void emit(Args... args) {
+            ++emitting_;
+            for (index_t i = 0; i < used_; ++i) {
+                if (state_[i] == ACTIVE) slots_[i](args...);
+            }
+            if (--emitting_ == 0 && dirty_) sweep();
+        }
+
+        void operator()(Args... args) { emit(args...); }
+
+        // queue an event for the next flush(), false if the queue is full
+        bool post(Args... args) {
+            if (pending_.size() >= Pending) return false;
+            pending_.push_back(event_t(args...));
+            return true;
+        }
+
+        // emit every event queued before this call, returns how many were emitted.
+        // events posted by handlers while flushing are kept for the next flush()
+        size_t flush() {
+            const size_t n = pending_.size();
+            for (size_t k = 0; k < n; ++k) {
+                event_t event = stdx::move(pending_.front());
+                pending_.pop_front();
+                emit_event(event, sequence_t());
+            }
+            return n;
+        }
+
+        size_t pending() const { return pending_.size(); }
+
+    private:
+        template<size_t... Is>
+        void emit_event(event_t &event, detail::index_sequence<Is...>) {
+            emit(detail::pack_get<Is>(event)...);
+        }
+
+        void release(index_t i) {
+            slots_[i] = nullptr;
+            state_[i] = FREE;
+            next_free_[i] = free_;
+            free_ = i;
+        }
+
+        void sweep() {
+            for (index_t i = 0; i < used_; ++i) {
+                if (state_[i] == REMOVED) release(i);
+                else if (state_[i] == ADDED) state_[i] = ACTIVE;
+            }
+            while (used_ > 0 && state_[used_ - 1] == FREE) --used_;
+            dirty_ = false;
+        }
+    };
+
+} // namespace arx
+
+#endif //ARX_SIGNAL_H
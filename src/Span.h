@@ -0,0 +1,136 @@
+#pragma once
+
+#ifndef ARX_SPAN_H
+#define ARX_SPAN_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "TypeTraits.h"
+
+namespace arx {
+    namespace stdx {
+
+        template<typename T>
+        class span;
+
+        namespace detail {
+            // containers with data() / size() whose elements are contiguous
+            template<typename C, typename T, typename = void>
+            struct is_contiguous_of {
+                static const bool value = false;
+            };
+
+            template<typename C, typename T>
+            struct is_contiguous_of<C, T, decltype((void) static_cast<T *>(declval<C &>().data()),
+                                                   (void) declval<C &>().size())> {
+                static const bool value = true;
+            };
+
+            // ring buffers have data() too, but are only contiguous after linearize()
+            template<typename C, typename T, typename = void>
+            struct is_linearizable_to {
+                static const bool value = false;
+            };
+
+            template<typename C, typename T>
+            struct is_linearizable_to<C, T, decltype((void) span<T>(declval<C &>().linearize()))> {
+                static const bool value = true;
+            };
+        } // namespace detail
+
+        // Non-owning view of size() contiguous elements (std::span with a dynamic extent).
+        // Two words, cheap to pass by value; the viewed elements must outlive the span.
+        template<typename T>
+        class span {
+            T *data_;
+            size_t size_;
+
+        public:
+            using element_type = T;
+            using value_type = typename remove_cv<T>::type;
+            using iterator = T *;
+
+            static const size_t npos = size_t(-1);
+
+            span() : data_(nullptr), size_(0) {}
+
+            span(T *data, size_t size) : data_(data), size_(size) {}
+
+            // a template, so that span(p, 0) is not ambiguous with the (pointer, size) constructor
+            template<typename U, typename = typename enable_if<is_same<U, T>::value || is_same<const U, T>::value>::type>
+            span(U *first, U *last) : data_(first), size_(static_cast<size_t>(last - first)) {}
+
+            template<size_t M>
+            span(T (&arr)[M]) : data_(arr), size_(M) {}
+
+            // span<T> to span<const T>
+            template<typename U, typename = typename enable_if<is_same<const U, T>::value>::type>
+            span(const span<U> &s) : data_(s.data()), size_(s.size()) {}
+
+            // arx::stdx::set, arx::inplace_string, std::vector, ...
+            template<typename C, typename = typename enable_if<
+                    detail::is_contiguous_of<C, T>::value && !detail::is_linearizable_to<C, T>::value &&
+                    !is_same<typename remove_cv<C>::type, span>::value
+            >::type>
+            span(C &c) : data_(c.data()), size_(c.size()) {}
+
+            template<typename C, typename = typename enable_if<
+                    detail::is_contiguous_of<const C, T>::value && !detail::is_linearizable_to<C, T>::value &&
+                    !is_same<C, span>::value
+            >::type, typename = void>
+            span(const C &c) : data_(c.data()), size_(c.size()) {}
+
+            // vector, array, deque (RingBuffer): the elements are first moved into one piece if
+            // they wrap around the end of the storage (see RingBuffer::linearize())
+            template<typename C, typename = typename enable_if<detail::is_linearizable_to<C, T>::value>::type,
+                    typename = void, typename = void>
+            span(C &c) : span(c.linearize()) {}
+
+            T *data() const { return data_; }
+
+            size_t size() const { return size_; }
+
+            size_t size_bytes() const { return size_ * sizeof(T); }
+
+            bool empty() const { return size_ == 0; }
+
+            T &operator[](size_t i) const { return data_[i]; }
+
+            // undefined if empty
+            T &front() const { return data_[0]; }
+
+            T &back() const { return data_[size_ - 1]; }
+
+            iterator begin() const { return data_; }
+
+            iterator end() const { return data_ + size_; }
+
+            // sub-views; counts are clamped to the elements available
+            span first(size_t n) const { return span(data_, n < size_ ? n : size_); }
+
+            span last(size_t n) const {
+                if (n > size_) n = size_;
+                return span(data_ + size_ - n, n);
+            }
+
+            span subspan(size_t offset, size_t count = npos) const {
+                if (offset > size_) offset = size_;
+                const size_t rest = size_ - offset;
+                return span(data_ + offset, count < rest ? count : rest);
+            }
+        };
+
+        template<typename T>
+        inline span<const uint8_t> as_bytes(span<T> s) {
+            return span<const uint8_t>(reinterpret_cast<const uint8_t *>(s.data()), s.size_bytes());
+        }
+
+        template<typename T>
+        inline span<uint8_t> as_writable_bytes(span<T> s) {
+            return span<uint8_t>(reinterpret_cast<uint8_t *>(s.data()), s.size_bytes());
+        }
+
+    } // namespace stdx
+} // namespace arx
+
+#endif //ARX_SPAN_H
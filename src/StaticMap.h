@@ -0,0 +1,260 @@
+#pragma once
+
+#ifndef ARX_STATIC_MAP_H
+#define ARX_STATIC_MAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#ifdef __AVR__
+    #include <avr/pgmspace.h>
+#endif
+#include "TypeTraits.h"
+#include "Pair.h"
+#include "StaticTable.h"
+
+namespace arx {
+
+    namespace detail {
+        ARX_CONSTEXPR14 uint32_t static_mix(uint32_t x) {
+            x ^= x >> 16;
+            x *= 0x7FEB352DUL;
+            x ^= x >> 15;
+            x *= 0x846CA68BUL;
+            x ^= x >> 16;
+            return x;
+        }
+
+        // 32-bit key hashes, the same at compile time, on the host and on the board
+        template<typename K, bool Integral = stdx::is_integral<K>::value>
+        struct static_hash;
+
+        template<typename K>
+        struct static_hash<K, true> {
+            ARX_CONSTEXPR14 uint32_t operator()(K key) const {
+                // (key >> 16) >> 16: no shift by the full width of 32-bit keys
+                const uint32_t folded = static_cast<uint32_t>(key) ^
+                        (sizeof(K) > 4 ? static_cast<uint32_t>((key >> 16) >> 16) : 0);
+                return static_mix(folded);
+            }
+        };
+
+        template<>
+        struct static_hash<const char *, false> {
+            ARX_CONSTEXPR14 uint32_t operator()(const char *s) const {
+                uint32_t h = 2166136261UL;  // FNV-1a
+                while (*s) {
+                    h ^= static_cast<unsigned char>(*s++);
+                    h *= 16777619UL;
+                }
+                return static_mix(h);
+            }
+        };
+
+        template<typename K>
+        struct static_equal {
+            constexpr bool operator()(const K &a, const K &b) const { return a == b; }
+        };
+
+        template<>
+        struct static_equal<const char *> {
+            ARX_CONSTEXPR14 bool operator()(const char *a, const char *b) const {
+                while (*a && *a == *b) {
+                    ++a;
+                    ++b;
+                }
+                return *a == *b;
+            }
+        };
+
+        // slots: a power of two with at least N / 0.8, so that the displacement search ends quickly
+        constexpr size_t static_map_slots(size_t n, size_t slots = 1) {
+            return slots * 4 >= n * 5 ? slots : static_map_slots(n, slots * 2);
+        }
+
+        // copies bytes of a table that may be in PROGMEM
+        inline void static_map_read(void *dst, const void *src, size_t n) {
+#ifdef __AVR__
+            memcpy_P(dst, src, n);
+#else
+            memcpy(dst, src, n);
+#endif
+        }
+
+        // entry index type: uint8_t up to 254 entries (255 marks an empty slot)
+        template<bool Byte>
+        struct static_map_index {
+            using type = uint8_t;
+        };
+
+        template<>
+        struct static_map_index<false> {
+            using type = uint16_t;
+        };
+
+        struct static_bucket_larger {
+            const size_t *sizes;
+
+            constexpr bool operator()(size_t a, size_t b) const { return sizes[a] > sizes[b]; }
+        };
+    } // namespace detail
+
+    // Read-only map with a perfect hash (hash and displace), built from N entries at compile time
+    // when declared constexpr (C++14). The keys are split into N / 2 + 1 buckets by their hash;
+    // each bucket stores a seed that places all of its keys into distinct slots. A lookup hashes
+    // the key once, picks its slot with the seed of its bucket and compares one key.
+    //
+    // Keys are integers or const char * (compared by contents). With repeated keys, or if no
+    // seed fits (practically never), valid() is false and nothing is found.
+    //
+    // On AVR, declare it constexpr PROGMEM (C++14, since a table in flash cannot be filled at
+    // startup) and use the _P accessors, which read the table from flash:
+    //   static constexpr auto commands PROGMEM = arx::make_static_map<const char *, uint8_t>({
+    //       {"start", 1}, {"stop", 2}, {"reset", 3}});
+    //   uint8_t code;
+    //   if (commands.get_P("stop", code)) ...
+    template<typename Key, typename T, size_t N,
+            typename Hash = detail::static_hash<Key>, typename KeyEqual = detail::static_equal<Key>>
+    class static_map {
+    public:
+        using value_type = stdx::pair<Key, T>;
+
+        static constexpr size_t BUCKETS = N / 2 + 1;
+        static constexpr size_t SLOTS = detail::static_map_slots(N);
+
+    private:
+        // entry index per slot, N for an empty slot
+        using index_type = typename detail::static_map_index<(N < 0xFF)>::type;
+
+        static_assert(N > 0, "static_map needs at least one entry");
+
+        value_type entries_[N];
+        uint16_t seeds_[BUCKETS];
+        index_type slots_[SLOTS];
+        bool valid_;
+
+        static ARX_CONSTEXPR14 size_t slot_of(uint32_t hash, uint16_t seed) {
+            return detail::static_mix(hash + seed * 0x9E3779B9UL) & (SLOTS - 1);
+        }
+
+    public:
+        ARX_CONSTEXPR14 explicit static_map(const value_type (&entries)[N])
+                : entries_(), seeds_(), slots_(), valid_(true) {
+            uint32_t hashes[N] = {};
+            size_t sizes[BUCKETS] = {};
+            size_t order[BUCKETS] = {};
+            for (size_t i = 0; i < N; ++i) {
+                entries_[i] = entries[i];
+                hashes[i] = Hash()(entries[i].first);
+                ++sizes[hashes[i] % BUCKETS];
+            }
+            for (size_t s = 0; s < SLOTS; ++s) slots_[s] = static_cast<index_type>(N);
+
+            // largest buckets first, while most slots are still free
+            for (size_t b = 0; b < BUCKETS; ++b) order[b] = b;
+            detail::static_sort(order, order + BUCKETS, detail::static_bucket_larger {sizes});
+
+            for (size_t k = 0; k < BUCKETS && sizes[order[k]] > 0; ++k) {
+                const size_t b = order[k];
+                size_t members[N] = {};
+                size_t n = 0;
+                for (size_t i = 0; i < N; ++i)
+                    if (hashes[i] % BUCKETS == b) members[n++] = i;
+
+                // equal keys (or equal 32-bit hashes) collide with every seed
+                bool distinct = true;
+                for (size_t i = 0; i < n; ++i)
+                    for (size_t j = i + 1; j < n; ++j)
+                        if (hashes[members[i]] == hashes[members[j]]) distinct = false;
+
+                bool placed = false;
+                for (uint32_t seed = 1; distinct && !placed && seed <= 0xFFFF; ++seed) {
+                    size_t m = 0;
+                    while (m < n && slots_[slot_of(hashes[members[m]], seed)] == N) {
+                        slots_[slot_of(hashes[members[m]], seed)] = static_cast<index_type>(members[m]);
+                        ++m;
+                    }
+                    placed = (m == n);
+                    if (placed) {
+                        seeds_[b] = static_cast<uint16_t>(seed);
+                    } else {
+                        while (m > 0) {
+                            --m;
+                            slots_[slot_of(hashes[members[m]], seed)] = static_cast<index_type>(N);
+                        }
+                    }
+                }
+                if (!placed) {
+                    valid_ = false;
+                    for (size_t s = 0; s < SLOTS; ++s) slots_[s] = static_cast<index_type>(N);
+                    return;
+                }
+            }
+        }
+
+        // false if the keys repeat (nothing is found then)
+        constexpr bool valid() const { return valid_; }
+
+        static constexpr size_t size() { return N; }
+
+        // entries in the order given
+        constexpr const value_type *begin() const { return entries_; }
+
+        constexpr const value_type *end() const { return entries_ + N; }
+
+        // lookups of a table in RAM (or anywhere on boards with memory-mapped flash)
+        ARX_CONSTEXPR14 const value_type *find(const Key &key) const {
+            const uint32_t h = Hash()(key);
+            const size_t i = slots_[slot_of(h, seeds_[h % BUCKETS])];
+            return (i < N && KeyEqual()(entries_[i].first, key)) ? entries_ + i : end();
+        }
+
+        ARX_CONSTEXPR14 bool exist(const Key &key) const { return find(key) != end(); }
+
+        ARX_CONSTEXPR14 size_t count(const Key &key) const { return exist(key) ? 1 : 0; }
+
+        ARX_CONSTEXPR14 T value_or(const Key &key, const T &fallback) const {
+            const value_type *it = find(key);
+            return it != end() ? it->second : fallback;
+        }
+
+        // lookups of a PROGMEM table on AVR (the same as find() elsewhere): the value is copied
+        // into value, returns false if key is missing. Only for PROGMEM tables: on AVR the
+        // address is read as a flash address.
+        bool get_P(const Key &key, T &value) const {
+            const size_t i = find_index_P(key);
+            if (i == N) return false;
+            detail::static_map_read(&value, &entries_[i].second, sizeof(T));
+            return true;
+        }
+
+        bool exist_P(const Key &key) const { return find_index_P(key) != N; }
+
+    private:
+        size_t find_index_P(const Key &key) const {
+            const uint32_t h = Hash()(key);
+            uint16_t seed = 0;
+            index_type i = 0;
+            Key stored = Key();
+            detail::static_map_read(&seed, &seeds_[h % BUCKETS], sizeof(seed));
+            detail::static_map_read(&i, &slots_[slot_of(h, seed)], sizeof(i));
+            if (i >= N) return N;
+            detail::static_map_read(&stored, &entries_[i].first, sizeof(Key));
+            return KeyEqual()(stored, key) ? i : N;
+        }
+    };
+
+    template<typename Key, typename T, size_t N, typename Hash, typename KeyEqual>
+    constexpr size_t static_map<Key, T, N, Hash, KeyEqual>::BUCKETS;
+
+    template<typename Key, typename T, size_t N, typename Hash, typename KeyEqual>
+    constexpr size_t static_map<Key, T, N, Hash, KeyEqual>::SLOTS;
+
+    template<typename Key, typename T, size_t N>
+    constexpr static_map<Key, T, N> make_static_map(const stdx::pair<Key, T> (&entries)[N]) {
+        return static_map<Key, T, N>(entries);
+    }
+
+} // namespace arx
+
+#endif //ARX_STATIC_MAP_H
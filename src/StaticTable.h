@@ -0,0 +1,259 @@
+#pragma once
+
+#ifndef ARX_STATIC_TABLE_H
+#define ARX_STATIC_TABLE_H
+
+#include <stddef.h>
+#include "Pair.h"
+
+// C++14 relaxed constexpr (loops, assignments) for the functions that build the tables.
+// In C++11 they are ordinary functions and the tables are filled at startup instead.
+#ifndef ARX_CONSTEXPR14
+    #if __cplusplus >= 201402L
+        #define ARX_CONSTEXPR14 constexpr
+    #else
+        #define ARX_CONSTEXPR14
+    #endif
+#endif  // ARX_CONSTEXPR14
+
+namespace arx {
+
+    namespace detail {
+        // default order of the static tables: operator<, and string contents for const char *
+        template<typename T>
+        struct static_less {
+            constexpr bool operator()(const T &a, const T &b) const { return a < b; }
+        };
+
+        template<>
+        struct static_less<const char *> {
+            ARX_CONSTEXPR14 bool operator()(const char *a, const char *b) const {
+                while (*a && *a == *b) {
+                    ++a;
+                    ++b;
+                }
+                return static_cast<unsigned char>(*a) < static_cast<unsigned char>(*b);
+            }
+        };
+
+        template<typename T>
+        ARX_CONSTEXPR14 void static_swap(T &a, T &b) {
+            T tmp = a;
+            a = b;
+            b = tmp;
+        }
+
+        template<typename T, typename Compare>
+        ARX_CONSTEXPR14 void static_sift_down(T *first, size_t i, size_t n, const Compare &comp) {
+            for (size_t child = 2 * i + 1; child < n; i = child, child = 2 * i + 1) {
+                if (child + 1 < n && comp(first[child], first[child + 1])) ++child;
+                if (!comp(first[i], first[child])) return;
+                static_swap(first[i], first[child]);
+            }
+        }
+
+        // heap sort: O(n log n) without recursion, usable in constant expressions (C++14)
+        template<typename T, typename Compare>
+        ARX_CONSTEXPR14 void static_sort(T *first, T *last, const Compare &comp) {
+            const size_t n = static_cast<size_t>(last - first);
+            for (size_t i = n / 2; i > 0; --i) static_sift_down(first, i - 1, n, comp);
+            for (size_t end = n; end > 1; --end) {
+                static_swap(first[0], first[end - 1]);
+                static_sift_down(first, 0, end - 1, comp);
+            }
+        }
+
+        // removes repeats from a sorted range, returns the new end
+        template<typename T, typename Compare>
+        ARX_CONSTEXPR14 T *static_unique(T *first, T *last, const Compare &comp) {
+            if (first == last) return last;
+            T *out = first;
+            for (T *it = first + 1; it != last; ++it)
+                if (comp(*out, *it)) *++out = *it;
+            return out + 1;
+        }
+
+        // first element e with !comp(e, key)
+        template<typename T, typename K, typename Compare>
+        ARX_CONSTEXPR14 const T *static_lower_bound(const T *first, size_t n, const K &key, const Compare &comp) {
+            while (n > 0) {
+                const size_t half = n / 2;
+                if (comp(first[half], key)) {
+                    first += half + 1;
+                    n -= half + 1;
+                } else {
+                    n = half;
+                }
+            }
+            return first;
+        }
+
+        // compares pair keys with a key order
+        template<typename Compare>
+        struct static_key_less {
+            Compare comp;
+
+            template<typename P>
+            constexpr bool operator()(const P &a, const P &b) const { return comp(a.first, b.first); }
+        };
+    } // namespace detail
+
+    // Fixed-size array that is a literal type: an aggregate, so it can be brace-initialized in a
+    // constexpr variable, and filled by a constexpr function in C++14 (e.g. a CRC table)
+    template<typename T, size_t N>
+    struct static_array {
+        T elems_[N];  // public only so that static_array is an aggregate
+
+        static constexpr size_t size() { return N; }
+
+        static constexpr bool empty() { return N == 0; }
+
+        constexpr const T &operator[](size_t i) const { return elems_[i]; }
+
+        ARX_CONSTEXPR14 T &operator[](size_t i) { return elems_[i]; }
+
+        constexpr const T &front() const { return elems_[0]; }
+
+        constexpr const T &back() const { return elems_[N - 1]; }
+
+        constexpr const T *data() const { return elems_; }
+
+        ARX_CONSTEXPR14 T *data() { return elems_; }
+
+        constexpr const T *begin() const { return elems_; }
+
+        constexpr const T *end() const { return elems_ + N; }
+
+        ARX_CONSTEXPR14 T *begin() { return elems_; }
+
+        ARX_CONSTEXPR14 T *end() { return elems_ + N; }
+    };
+
+    // Read-only sorted set built from an array of up to N elements, sorted and de-duplicated by
+    // the constructor; declared constexpr (C++14), this happens at compile time.
+    //   constexpr auto codes = arx::make_static_set({0x2A, 0x03, 0x1F});
+    template<typename T, size_t N, typename Compare = detail::static_less<T>>
+    class static_set {
+        T elems_[N];
+        size_t size_;
+
+    public:
+        ARX_CONSTEXPR14 explicit static_set(const T (&elems)[N]) : elems_(), size_(0) {
+            for (size_t i = 0; i < N; ++i) elems_[i] = elems[i];
+            detail::static_sort(elems_, elems_ + N, Compare());
+            size_ = static_cast<size_t>(detail::static_unique(elems_, elems_ + N, Compare()) - elems_);
+        }
+
+        constexpr size_t size() const { return size_; }
+
+        constexpr bool empty() const { return size_ == 0; }
+
+        static constexpr size_t capacity() { return N; }
+
+        // ascending order
+        constexpr const T &operator[](size_t i) const { return elems_[i]; }
+
+        constexpr const T *data() const { return elems_; }
+
+        constexpr const T *begin() const { return elems_; }
+
+        constexpr const T *end() const { return elems_ + size_; }
+
+        ARX_CONSTEXPR14 const T *lower_bound(const T &key) const {
+            return detail::static_lower_bound(elems_, size_, key, Compare());
+        }
+
+        ARX_CONSTEXPR14 const T *find(const T &key) const {
+            const T *it = lower_bound(key);
+            return (it != end() && !Compare()(key, *it)) ? it : end();
+        }
+
+        ARX_CONSTEXPR14 bool exist(const T &key) const { return find(key) != end(); }
+
+        ARX_CONSTEXPR14 size_t count(const T &key) const { return exist(key) ? 1 : 0; }
+    };
+
+    template<typename T, size_t N>
+    constexpr static_set<T, N> make_static_set(const T (&elems)[N]) { return static_set<T, N>(elems); }
+
+    // Read-only map of up to N entries, sorted by key in the constructor (at compile time when
+    // declared constexpr in C++14) and searched by binary search. One of repeated keys is kept.
+    //   constexpr arx::static_sorted_map<const char *, uint8_t, 2> commands({{"start", 1}, {"stop", 2}});
+    template<typename Key, typename T, size_t N, typename Compare = detail::static_less<Key>>
+    class static_sorted_map {
+    public:
+        using value_type = stdx::pair<Key, T>;
+
+    private:
+        using entry_less = detail::static_key_less<Compare>;
+
+        value_type entries_[N];
+        size_t size_;
+
+        static constexpr T empty_value_ = T();
+
+    public:
+        ARX_CONSTEXPR14 explicit static_sorted_map(const value_type (&entries)[N]) : entries_(), size_(0) {
+            for (size_t i = 0; i < N; ++i) entries_[i] = entries[i];
+            detail::static_sort(entries_, entries_ + N, entry_less());
+            size_ = static_cast<size_t>(detail::static_unique(entries_, entries_ + N, entry_less()) - entries_);
+        }
+
+        constexpr size_t size() const { return size_; }
+
+        constexpr bool empty() const { return size_ == 0; }
+
+        static constexpr size_t capacity() { return N; }
+
+        // ascending key order
+        constexpr const value_type *begin() const { return entries_; }
+
+        constexpr const value_type *end() const { return entries_ + size_; }
+
+        ARX_CONSTEXPR14 const value_type *lower_bound(const Key &key) const {
+            const value_type *first = entries_;
+            size_t n = size_;
+            while (n > 0) {
+                const size_t half = n / 2;
+                if (Compare()(first[half].first, key)) {
+                    first += half + 1;
+                    n -= half + 1;
+                } else {
+                    n = half;
+                }
+            }
+            return first;
+        }
+
+        ARX_CONSTEXPR14 const value_type *find(const Key &key) const {
+            const value_type *it = lower_bound(key);
+            return (it != end() && !Compare()(key, it->first)) ? it : end();
+        }
+
+        ARX_CONSTEXPR14 bool exist(const Key &key) const { return find(key) != end(); }
+
+        ARX_CONSTEXPR14 size_t count(const Key &key) const { return exist(key) ? 1 : 0; }
+
+        // like map::at: a default-constructed T if key is missing
+        ARX_CONSTEXPR14 const T &at(const Key &key) const {
+            const value_type *it = find(key);
+            return it != end() ? it->second : empty_value_;
+        }
+
+        ARX_CONSTEXPR14 T value_or(const Key &key, const T &fallback) const {
+            const value_type *it = find(key);
+            return it != end() ? it->second : fallback;
+        }
+    };
+
+    template<typename Key, typename T, size_t N, typename Compare>
+    constexpr T static_sorted_map<Key, T, N, Compare>::empty_value_;
+
+    template<typename Key, typename T, size_t N>
+    constexpr static_sorted_map<Key, T, N> make_static_sorted_map(const stdx::pair<Key, T> (&entries)[N]) {
+        return static_sorted_map<Key, T, N>(entries);
+    }
+
+} // namespace arx
+
+#endif //ARX_STATIC_TABLE_H
@@ -0,0 +1,159 @@
+#pragma once
+
+#ifndef ARX_STRING_VIEW_H
+#define ARX_STRING_VIEW_H
+
+#ifdef ARDUINO
+    #include <Arduino.h>
+#endif
+#include <stddef.h>
+#include <string.h>
+#include "TypeTraits.h"
+#include "Functional.h"
+#include "Span.h"
+
+namespace arx {
+    namespace stdx {
+
+        // Non-owning view of a char sequence, not necessarily zero-terminated, for parsing text in
+        // place (a line in a RingBuffer, a token in a receive buffer) without copying it into a String.
+        class string_view {
+            const char *data_;
+            size_t size_;
+
+        public:
+            using iterator = const char *;
+
+            static const size_t npos = size_t(-1);
+
+            string_view() : data_(nullptr), size_(0) {}
+
+            string_view(const char *s) : data_(s), size_(s ? strlen(s) : 0) {}
+
+            string_view(const char *s, size_t n) : data_(s), size_(n) {}
+
+            string_view(span<const char> s) : data_(s.data()), size_(s.size()) {}
+
+            // String, arx::inplace_string, std::string, ...; the string must outlive the view
+            template<typename S, typename = typename enable_if<detail::is_contiguous_of<const S, const char>::value>::type>
+            string_view(const S &s) : data_(s.data()), size_(s.size()) {}
+
+#ifdef ARDUINO
+            string_view(const String &s) : data_(s.c_str()), size_(s.length()) {}
+#endif
+
+            const char *data() const { return data_; }
+
+            size_t size() const { return size_; }
+
+            size_t length() const { return size_; }
+
+            bool empty() const { return size_ == 0; }
+
+            char operator[](size_t i) const { return data_[i]; }
+
+            // undefined if empty
+            char front() const { return data_[0]; }
+
+            char back() const { return data_[size_ - 1]; }
+
+            iterator begin() const { return data_; }
+
+            iterator end() const { return data_ + size_; }
+
+            void remove_prefix(size_t n) {
+                if (n > size_) n = size_;
+                data_ += n;
+                size_ -= n;
+            }
+
+            void remove_suffix(size_t n) { size_ -= n < size_ ? n : size_; }
+
+            // positions and counts are clamped instead of throwing
+            string_view substr(size_t pos, size_t count = npos) const {
+                if (pos > size_) pos = size_;
+                const size_t rest = size_ - pos;
+                return string_view(data_ + pos, count < rest ? count : rest);
+            }
+
+            size_t find(char c, size_t pos = 0) const {
+                if (pos >= size_) return npos;
+                const void *p = memchr(data_ + pos, c, size_ - pos);
+                return p ? static_cast<size_t>(static_cast<const char *>(p) - data_) : npos;
+            }
+
+            size_t find(string_view s, size_t pos = 0) const {
+                if (s.size_ == 0) return pos <= size_ ? pos : npos;
+                while (s.size_ <= size_ && pos <= size_ - s.size_) {
+                    // memchr for the first char, then compare the rest
+                    const size_t i = find(s.data_[0], pos);
+                    if (i == npos || i > size_ - s.size_) return npos;
+                    if (equal(data_ + i, s.data_, s.size_)) return i;
+                    pos = i + 1;
+                }
+                return npos;
+            }
+
+            size_t rfind(char c) const {
+                for (size_t i = size_; i > 0; --i)
+                    if (data_[i - 1] == c) return i - 1;
+                return npos;
+            }
+
+            bool starts_with(string_view s) const {
+                return s.size_ <= size_ && equal(data_, s.data_, s.size_);
+            }
+
+            bool ends_with(string_view s) const {
+                return s.size_ <= size_ && equal(data_ + size_ - s.size_, s.data_, s.size_);
+            }
+
+            // <0, 0, >0 like strcmp
+            int compare(string_view s) const {
+                const size_t n = size_ < s.size_ ? size_ : s.size_;
+                const int r = n ? memcmp(data_, s.data_, n) : 0;
+                if (r != 0) return r;
+                return size_ < s.size_ ? -1 : (size_ > s.size_ ? 1 : 0);
+            }
+
+            friend bool operator==(string_view a, string_view b) {
+                return a.size_ == b.size_ && equal(a.data_, b.data_, a.size_);
+            }
+
+            friend bool operator!=(string_view a, string_view b) { return !(a == b); }
+
+            friend bool operator<(string_view a, string_view b) { return a.compare(b) < 0; }
+
+            friend bool operator>(string_view a, string_view b) { return b.compare(a) < 0; }
+
+            friend bool operator<=(string_view a, string_view b) { return a.compare(b) <= 0; }
+
+            friend bool operator>=(string_view a, string_view b) { return a.compare(b) >= 0; }
+
+        private:
+            // empty views may have a null data()
+            static bool equal(const char *a, const char *b, size_t n) { return n == 0 || memcmp(a, b, n) == 0; }
+        };
+
+#if !ARX_STD_FUNCTIONAL
+        // same value as hash<const char *> for the same contents
+        template<>
+        struct hash<string_view> {
+            size_t operator()(string_view s) const { return hash_bytes(s.data(), s.size()); }
+        };
+#endif
+
+    } // namespace stdx
+} // namespace arx
+
+#if ARX_STD_FUNCTIONAL
+namespace std {
+    // stdx::hash is std::hash here (see Functional.h)
+    template<>
+    struct hash<arx::stdx::string_view> {
+        size_t operator()(arx::stdx::string_view s) const { return arx::stdx::hash_bytes(s.data(), s.size()); }
+    };
+} // namespace std
+#endif
+
+#endif //ARX_STRING_VIEW_H
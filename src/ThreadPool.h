@@ -0,0 +1,316 @@
+#pragma once
+
+#ifndef ARX_THREAD_POOL_H
+#define ARX_THREAD_POOL_H
+
+#ifndef ARX_THREAD_POOL_DEFAULT_QUEUE_SIZE
+#define ARX_THREAD_POOL_DEFAULT_QUEUE_SIZE 256
+#endif  // ARX_THREAD_POOL_DEFAULT_QUEUE_SIZE
+
+#include "ArxContainer.h"
+
+#if !ARX_SYSTEM_HAS_INCLUDE(<thread>) || (ARX_HAVE_LIBSTDCPLUSPLUS < 201103L)
+#error "thread_pool needs <thread>, <atomic> and <mutex> from the C++11 standard library"
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "RingBuffer.h"
+
+namespace arx {
+
+    // Chase-Lev work-stealing deque with fixed capacity N (a power of two).
+    // Like RingBuffer, slots live in an inline array addressed by ever-increasing positions;
+    // here the head (top) and tail (bottom) are atomics. Only the owner thread may push() and pop()
+    // at the bottom, any thread may steal() from the top.
+    // A slot is claimed by moving top or bottom before it is read, and stays busy until the reader
+    // has moved the value out, so T does not have to be trivially copyable.
+    template<typename T, size_t N>
+    class work_stealing_deque {
+        static_assert(N > 0 && (N & (N - 1)) == 0, "work_stealing_deque capacity must be a power of two");
+
+        static const size_t MASK = N - 1;
+
+        struct Slot {
+            T value;
+            std::atomic<bool> busy{false};
+        };
+
+        // top and bottom on separate cache lines: thieves only write top, the owner mostly bottom
+        std::atomic<ptrdiff_t> top_{0};
+        char pad0_[64 - sizeof(std::atomic<ptrdiff_t>)];
+        std::atomic<ptrdiff_t> bottom_{0};
+        char pad1_[64 - sizeof(std::atomic<ptrdiff_t>)];
+        Slot slots_[N];
+
+    public:
+        work_stealing_deque() = default;
+
+        work_stealing_deque(const work_stealing_deque &) = delete;
+
+        work_stealing_deque &operator=(const work_stealing_deque &) = delete;
+
+        // owner only, false if the deque is full
+        bool push(T &&value) {
+            const ptrdiff_t b = bottom_.load(std::memory_order_relaxed);
+            const ptrdiff_t t = top_.load(std::memory_order_acquire);
+            if (b - t >= static_cast<ptrdiff_t>(N)) return false;
+            Slot &slot = slots_[b & MASK];
+            // a thief that claimed this slot a lap ago may still be reading it
+            if (slot.busy.load(std::memory_order_acquire)) return false;
+            slot.value = stdx::move(value);
+            slot.busy.store(true, std::memory_order_relaxed);
+            bottom_.store(b + 1, std::memory_order_release);
+            return true;
+        }
+
+        // owner only, takes the most recently pushed value
+        bool pop(T &value) {
+            // every bottom store is a release, so a thief reading any of them sees the pushed values
+            const ptrdiff_t b = bottom_.load(std::memory_order_relaxed) - 1;
+            bottom_.store(b, std::memory_order_release);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            ptrdiff_t t = top_.load(std::memory_order_relaxed);
+            if (t > b) {
+                bottom_.store(b + 1, std::memory_order_release);
+                return false;
+            }
+            if (t == b) {
+                // last element: race the thieves for it
+                const bool won = top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                                              std::memory_order_relaxed);
+                bottom_.store(b + 1, std::memory_order_release);
+                if (!won) return false;
+            }
+            take(slots_[b & MASK], value);
+            return true;
+        }
+
+        // any thread, takes the oldest value
+        bool steal(T &value) {
+            ptrdiff_t t = top_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const ptrdiff_t b = bottom_.load(std::memory_order_acquire);
+            if (t >= b) return false;
+            if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                return false;
+            take(slots_[t & MASK], value);
+            return true;
+        }
+
+        // approximate when other threads are pushing or stealing
+        size_t size() const {
+            const ptrdiff_t b = bottom_.load(std::memory_order_relaxed);
+            const ptrdiff_t t = top_.load(std::memory_order_relaxed);
+            return b > t ? static_cast<size_t>(b - t) : 0;
+        }
+
+        bool empty() const { return size() == 0; }
+
+        size_t capacity() const { return N; }
+
+    private:
+        static void take(Slot &slot, T &value) {
+            value = stdx::move(slot.value);
+            slot.value = T();
+            slot.busy.store(false, std::memory_order_release);
+        }
+    };
+
+    // Fixed-size thread pool. Every worker owns a work_stealing_deque: tasks submitted from a worker
+    // go to its own deque, tasks submitted from other threads go to a shared RingBuffer that workers
+    // drain in batches into their deques. Idle workers steal from the top of the other deques.
+    // QueueSize is the capacity of the shared queue and of each worker deque.
+    template<size_t QueueSize = ARX_THREAD_POOL_DEFAULT_QUEUE_SIZE>
+    class thread_pool {
+    public:
+        using task_type = stdx::function<void()>;
+
+    private:
+        struct Worker {
+            work_stealing_deque<task_type, QueueSize> deque;
+            std::thread thread;
+        };
+
+        // the pool and worker index of the calling thread, if it is a worker
+        struct Current {
+            const thread_pool *pool;
+            size_t index;
+        };
+
+        std::unique_ptr<Worker[]> workers_;
+        size_t size_;
+
+        std::mutex mutex_;
+        std::condition_variable work_cv_;
+        std::condition_variable space_cv_;
+        std::condition_variable done_cv_;
+        RingBuffer<task_type, QueueSize> injected_;  // guarded by mutex_
+        std::atomic<size_t> injected_size_{0};
+        std::atomic<size_t> pending_{0};  // submitted and not yet finished
+        std::atomic<size_t> sleepers_{0};
+        bool stop_{false};  // guarded by mutex_
+
+    public:
+        explicit thread_pool(size_t workers = std::thread::hardware_concurrency())
+        : workers_(new Worker[workers ? workers : 1]), size_(workers ? workers : 1) {
+            for (size_t i = 0; i < size_; ++i) workers_[i].thread = std::thread(&thread_pool::run, this, i);
+        }
+
+        thread_pool(const thread_pool &) = delete;
+
+        thread_pool &operator=(const thread_pool &) = delete;
+
+        // finishes every submitted task before the workers are joined
+        ~thread_pool() {
+            wait_all();
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stop_ = true;
+            }
+            work_cv_.notify_all();
+            for (size_t i = 0; i < size_; ++i) workers_[i].thread.join();
+        }
+
+        // may block while the shared queue is full; from inside a task, a task that fits nowhere
+        // is run immediately instead
+        void submit(task_type task) {
+            pending_.fetch_add(1, std::memory_order_relaxed);
+            const Current &cur = current();
+            if (cur.pool == this) {
+                if (workers_[cur.index].deque.push(stdx::move(task))) {
+                    wake_one();
+                    return;
+                }
+                if (!try_inject(task)) {
+                    task();
+                    finish();
+                }
+                return;
+            }
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                space_cv_.wait(lock, [this] { return injected_.size() < QueueSize; });
+                injected_.push_back(stdx::move(task));
+                injected_size_.store(injected_.size(), std::memory_order_relaxed);
+            }
+            wake_one();
+        }
+
+        // blocks until every submitted task has finished. Must not be called from a task
+        void wait_all() {
+            std::unique_lock<std::mutex> lock(mutex_);
+            done_cv_.wait(lock, [this] { return pending_.load(std::memory_order_acquire) == 0; });
+        }
+
+        size_t size() const { return size_; }
+
+        size_t pending() const { return pending_.load(std::memory_order_relaxed); }
+
+    private:
+        static Current &current() {
+            static thread_local Current cur = {nullptr, 0};
+            return cur;
+        }
+
+        void run(size_t index) {
+            current().pool = this;
+            current().index = index;
+            uint32_t seed = static_cast<uint32_t>(index) * 2654435761UL + 1;
+            task_type task;
+            for (;;) {
+                if (find_task(index, seed, task)) {
+                    task();
+                    task = nullptr;
+                    finish();
+                    continue;
+                }
+                std::unique_lock<std::mutex> lock(mutex_);
+                sleepers_.fetch_add(1, std::memory_order_seq_cst);
+                // check again after announcing the sleep: a pusher either sees sleepers_ or we see its task
+                while (!stop_ && injected_.empty() && !any_stealable()) work_cv_.wait(lock);
+                sleepers_.fetch_sub(1, std::memory_order_relaxed);
+                if (stop_) return;
+            }
+        }
+
+        bool find_task(size_t index, uint32_t &seed, task_type &task) {
+            if (workers_[index].deque.pop(task)) return true;
+            if (take_injected(index, task)) return true;
+            if (size_ == 1) return false;
+            // visit the other workers starting at a random victim
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            const size_t first = seed % size_;
+            for (size_t k = 0; k < size_; ++k) {
+                const size_t victim = (first + k) % size_;
+                if (victim != index && workers_[victim].deque.steal(task)) return true;
+            }
+            return false;
+        }
+
+        // takes one task to run and moves a fair share of the rest into the worker's deque,
+        // so the shared lock is taken once per batch rather than once per task
+        bool take_injected(size_t index, task_type &task) {
+            if (injected_size_.load(std::memory_order_relaxed) == 0) return false;
+            size_t moved = 0;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (injected_.empty()) return false;
+                task = stdx::move(injected_.front());
+                injected_.pop_front();
+                size_t batch = (injected_.size() + size_ - 1) / size_;
+                if (batch > QueueSize / 2) batch = QueueSize / 2;
+                work_stealing_deque<task_type, QueueSize> &deque = workers_[index].deque;
+                while (moved < batch && deque.push(stdx::move(injected_.front()))) {
+                    injected_.pop_front();
+                    ++moved;
+                }
+                injected_size_.store(injected_.size(), std::memory_order_relaxed);
+            }
+            space_cv_.notify_all();
+            if (moved) wake_one();
+            return true;
+        }
+
+        bool try_inject(task_type &task) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (injected_.size() >= QueueSize) return false;
+                injected_.push_back(stdx::move(task));
+                injected_size_.store(injected_.size(), std::memory_order_relaxed);
+            }
+            wake_one();
+            return true;
+        }
+
+        bool any_stealable() const {
+            for (size_t i = 0; i < size_; ++i)
+                if (!workers_[i].deque.empty()) return true;
+            return false;
+        }
+
+        void wake_one() {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (sleepers_.load(std::memory_order_relaxed) == 0) return;
+            std::lock_guard<std::mutex> lock(mutex_);
+            work_cv_.notify_one();
+        }
+
+        void finish() {
+            if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                done_cv_.notify_all();
+            }
+        }
+    };
+
+} // namespace arx
+
+#endif //ARX_THREAD_POOL_H
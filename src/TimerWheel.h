@@ -0,0 +1,257 @@
+#pragma once
+
+#ifndef ARX_TIMER_WHEEL_H
+#define ARX_TIMER_WHEEL_H
+
+#ifndef ARX_TIMER_WHEEL_DEFAULT_SIZE
+#define ARX_TIMER_WHEEL_DEFAULT_SIZE 16
+#endif  // ARX_TIMER_WHEEL_DEFAULT_SIZE
+
+// Each level has 2^SLOT_BITS buckets and the wheel covers delays up to 2^(SLOT_BITS * LEVELS) - 1 ticks
+// (2^24 ms, about 4.6 hours, by default). AVR uses smaller levels to save RAM on the bucket heads.
+#ifndef ARX_TIMER_WHEEL_DEFAULT_SLOT_BITS
+    #ifdef __AVR__
+        #define ARX_TIMER_WHEEL_DEFAULT_SLOT_BITS 4
+    #else
+        #define ARX_TIMER_WHEEL_DEFAULT_SLOT_BITS 6
+    #endif
+#endif  // ARX_TIMER_WHEEL_DEFAULT_SLOT_BITS
+
+#ifndef ARX_TIMER_WHEEL_DEFAULT_LEVELS
+    #ifdef __AVR__
+        #define ARX_TIMER_WHEEL_DEFAULT_LEVELS 6
+    #else
+        #define ARX_TIMER_WHEEL_DEFAULT_LEVELS 4
+    #endif
+#endif  // ARX_TIMER_WHEEL_DEFAULT_LEVELS
+
+#ifdef ARDUINO
+    #include <Arduino.h>
+#endif
+#include <stdint.h>
+#include "ArxContainer.h"
+
+namespace arx {
+
+    // Hierarchical timing wheel for deferred callbacks.
+    // Timers live in a fixed node array and are linked into per-level buckets by 16-bit indices,
+    // so schedule() and cancel() are O(1) and nothing is allocated. Level 0 has one bucket per tick;
+    // a timer further out sits in a coarser level and is moved down when the level below wraps.
+    template<size_t N = ARX_TIMER_WHEEL_DEFAULT_SIZE,
+            size_t SlotBits = ARX_TIMER_WHEEL_DEFAULT_SLOT_BITS,
+            size_t Levels = ARX_TIMER_WHEEL_DEFAULT_LEVELS>
+    class timer_wheel {
+        static_assert(N > 0 && N < 0xFFFF, "timer_wheel capacity must fit in 16-bit links");
+        static_assert(SlotBits > 0 && Levels > 0 && SlotBits * Levels <= 31,
+                      "timer_wheel range must fit in 31 bits of the tick counter");
+
+        using index_t = uint16_t;
+        static const index_t NIL = 0xFFFF;
+
+        static const size_t SLOTS = size_t(1) << SlotBits;
+        static const uint32_t MASK = SLOTS - 1;
+
+    public:
+        using callback_type = stdx::function<void()>;
+
+        static const uint32_t MAX_DELAY = (uint32_t(1) << (SlotBits * Levels)) - 1;
+
+        struct timer {
+            index_t index{NIL};
+            index_t generation{0};
+
+            bool valid() const { return index != NIL; }
+        };
+
+    private:
+        struct Node {
+            callback_type callback;
+            uint32_t deadline;
+            index_t prev;
+            index_t next;
+            index_t bucket;  // NIL while free or running
+            index_t generation;
+        };
+
+        Node nodes_[N];
+        index_t buckets_[SLOTS * Levels];  // level l, slot s is buckets_[l * SLOTS + s]
+        index_t free_;  // singly linked through Node::next
+        size_t size_;
+        size_t level0_size_;
+        uint32_t now_;  // last tick that has been processed
+
+    public:
+        explicit timer_wheel(uint32_t now = 0) : now_(now) {
+            for (size_t i = 0; i < N; ++i) {
+                nodes_[i].bucket = NIL;
+                nodes_[i].generation = 0;
+                nodes_[i].next = static_cast<index_t>(i + 1 < N ? i + 1 : NIL);
+            }
+            for (size_t i = 0; i < SLOTS * Levels; ++i) buckets_[i] = NIL;
+            free_ = 0;
+            size_ = level0_size_ = 0;
+        }
+
+        timer_wheel(const timer_wheel &) = delete;
+
+        timer_wheel &operator=(const timer_wheel &) = delete;
+
+        // run callback once, delay ticks after the last update() (at least one tick, at most MAX_DELAY).
+        // returns an invalid timer if all N timers are in use
+        timer schedule(uint32_t delay, callback_type callback) {
+            timer t;
+            if (free_ == NIL || !callback) return t;
+            if (delay == 0) delay = 1;
+            if (delay > MAX_DELAY) delay = MAX_DELAY;
+
+            const index_t i = free_;
+            Node &node = nodes_[i];
+            free_ = node.next;
+            node.callback = stdx::move(callback);
+            node.deadline = now_ + delay;
+            link(i);
+            ++size_;
+
+            t.index = i;
+            t.generation = node.generation;
+            return t;
+        }
+
+        bool cancel(timer &t) {
+            if (!pending(t)) return false;
+            unlink(t.index);
+            release(t.index);
+            t = timer();
+            return true;
+        }
+
+        bool pending(const timer &t) const {
+            return t.index < N && nodes_[t.index].generation == t.generation && nodes_[t.index].bucket != NIL;
+        }
+
+        // ticks left until t fires, 0 if it is not pending
+        uint32_t remaining(const timer &t) const {
+            return pending(t) ? nodes_[t.index].deadline - now_ : 0;
+        }
+
+        // advance the wheel to now and run every expired callback, returns how many ran.
+        // callbacks may schedule and cancel timers, including themselves
+        size_t update(uint32_t now) {
+            size_t fired = 0;
+            while (static_cast<int32_t>(now - now_) > 0) {
+                if (size_ == 0) {
+                    now_ = now;
+                    break;
+                }
+                if (level0_size_ == 0) {
+                    // nothing can fire before level 0 wraps: skip to the tick before the next cascade
+                    const uint32_t skip = now_ | MASK;
+                    if (static_cast<int32_t>(now - skip) <= 0) {
+                        now_ = now;
+                        break;
+                    }
+                    now_ = skip;
+                }
+                ++now_;
+                const size_t slot = now_ & MASK;
+                if (slot == 0) cascade(1);
+                fired += expire(slot);
+            }
+            return fired;
+        }
+
+#ifdef ARDUINO
+        size_t update() { return update(millis()); }
+#endif
+
+        uint32_t now() const { return now_; }
+
+        size_t size() const { return size_; }
+
+        bool empty() const { return size_ == 0; }
+
+        bool full() const { return free_ == NIL; }
+
+        size_t capacity() const { return N; }
+
+        void clear() {
+            for (size_t i = 0; i < SLOTS * Levels; ++i) {
+                while (buckets_[i] != NIL) {
+                    const index_t n = buckets_[i];
+                    unlink(n);
+                    release(n);
+                }
+            }
+        }
+
+    private:
+        void link(index_t i) {
+            Node &node = nodes_[i];
+            const uint32_t delta = node.deadline - now_;
+            size_t level = 0;
+            while (level + 1 < Levels && delta >= (uint32_t(1) << (SlotBits * (level + 1)))) ++level;
+            if (level == 0) ++level0_size_;
+
+            const index_t b = static_cast<index_t>(level * SLOTS + ((node.deadline >> (SlotBits * level)) & MASK));
+            node.bucket = b;
+            node.prev = NIL;
+            node.next = buckets_[b];
+            if (node.next != NIL) nodes_[node.next].prev = i;
+            buckets_[b] = i;
+        }
+
+        void unlink(index_t i) {
+            Node &node = nodes_[i];
+            if (node.prev != NIL) nodes_[node.prev].next = node.next;
+            else buckets_[node.bucket] = node.next;
+            if (node.next != NIL) nodes_[node.next].prev = node.prev;
+            if (node.bucket < SLOTS) --level0_size_;
+            node.bucket = NIL;
+        }
+
+        void release(index_t i) {
+            Node &node = nodes_[i];
+            node.callback = nullptr;
+            ++node.generation;
+            node.next = free_;
+            free_ = i;
+            --size_;
+        }
+
+        // move the timers of the current slot of this level down, after the level below wrapped
+        void cascade(size_t level) {
+            if (level >= Levels) return;
+            const size_t slot = (now_ >> (SlotBits * level)) & MASK;
+            if (slot == 0) cascade(level + 1);
+
+            index_t i = buckets_[level * SLOTS + slot];
+            buckets_[level * SLOTS + slot] = NIL;
+            while (i != NIL) {
+                const index_t next = nodes_[i].next;
+                link(i);
+                i = next;
+            }
+        }
+
+        size_t expire(size_t slot) {
+            size_t fired = 0;
+            // pop one timer at a time, so that callbacks can cancel others in the same bucket
+            while (buckets_[slot] != NIL) {
+                const index_t i = buckets_[slot];
+                unlink(i);
+                // the node is freed before the call, so that a callback can re-arm itself on a full wheel
+                callback_type callback = stdx::move(nodes_[i].callback);
+                release(i);
+                callback();
+                ++fired;
+            }
+            return fired;
+        }
+    };
+
+} // namespace arx
+
+template<size_t N = ARX_TIMER_WHEEL_DEFAULT_SIZE>
+using ArxTimerWheel = arx::timer_wheel<N>;
+
+#endif //ARX_TIMER_WHEEL_H
@@ -38,6 +38,67 @@ namespace arx {
         struct is_trivially_copyable {
             static const bool value = __is_trivially_copyable(T);
         };
+
+        template<typename T>
+        struct remove_cv {
+            typedef T type;
+        };
+        template<typename T>
+        struct remove_cv<const T> {
+            typedef T type;
+        };
+        template<typename T>
+        struct remove_cv<volatile T> {
+            typedef T type;
+        };
+        template<typename T>
+        struct remove_cv<const volatile T> {
+            typedef T type;
+        };
+
+        template<typename T>
+        struct is_integral_base {
+            static const bool value = false;
+        };
+        template<> struct is_integral_base<bool> { static const bool value = true; };
+        template<> struct is_integral_base<char> { static const bool value = true; };
+        template<> struct is_integral_base<signed char> { static const bool value = true; };
+        template<> struct is_integral_base<unsigned char> { static const bool value = true; };
+        template<> struct is_integral_base<short> { static const bool value = true; };
+        template<> struct is_integral_base<unsigned short> { static const bool value = true; };
+        template<> struct is_integral_base<int> { static const bool value = true; };
+        template<> struct is_integral_base<unsigned int> { static const bool value = true; };
+        template<> struct is_integral_base<long> { static const bool value = true; };
+        template<> struct is_integral_base<unsigned long> { static const bool value = true; };
+        template<> struct is_integral_base<long long> { static const bool value = true; };
+        template<> struct is_integral_base<unsigned long long> { static const bool value = true; };
+
+        template<typename T>
+        struct is_integral {
+            static const bool value = is_integral_base<typename remove_cv<T>::type>::value;
+        };
+
+        template<typename T>
+        T &&declval();
+
+        template<typename T>
+        struct remove_reference {
+            typedef T type;
+        };
+        template<typename T>
+        struct remove_reference<T &> {
+            typedef T type;
+        };
+        template<typename T>
+        struct remove_reference<T &&> {
+            typedef T type;
+        };
+
+        // decay without the array/function-to-pointer conversions
+        template<typename T>
+        struct remove_cvref {
+            typedef typename remove_cv<typename remove_reference<T>::type>::type type;
+        };
     }
 }
 #endif //ARX_TYPE_TRAITS_H
@@ -21,6 +21,9 @@ namespace arx {
 
             vector(std::initializer_list<T> lst) : RingBuffer<T, N>(lst) {}
 
+            // N = dynamic_size only: storage for capacity elements from resource
+            vector(size_t capacity, memory_resource &resource) : RingBuffer<T, N>(capacity, resource) {}
+
             // copy
             vector(const vector &r) : RingBuffer<T, N>(r) {}
 
@@ -30,10 +33,10 @@ namespace arx {
             }
 
             // move
-            vector(vector &&r) : RingBuffer<T, N>(r) {}
+            vector(vector &&r) : RingBuffer<T, N>(stdx::move(r)) {}
 
             vector &operator=(vector &&r) {
-                RingBuffer<T, N>::operator=(r);
+                RingBuffer<T, N>::operator=(stdx::move(r));
                 return *this;
             }
 
@@ -46,6 +49,11 @@ namespace arx {
             using RingBuffer<T, N>::fill;
         };
     } // namespace arx
+
+    namespace pmr {
+        template<typename T>
+        using vector = stdx::vector<T, dynamic_size>;
+    } // namespace pmr
 } // namespace stdx
 
 #endif //ARX_VECTOR_H
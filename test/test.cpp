@@ -2,6 +2,23 @@
 #include <Arduino.h>
 #include "test_set.h"
 #include "test_function.h"
+#include "test_map.h"
+#include "test_lru_cache.h"
+#include "test_bitset_set.h"
+#include "test_frozen_set.h"
+#include "test_signal.h"
+#include "test_timer_wheel.h"
+#include "test_pool.h"
+#include "test_memory_resource.h"
+#include "test_priority_queue.h"
+#include "test_intrusive_list.h"
+#include "test_inplace_string.h"
+#include "test_span.h"
+#include "test_container_stats.h"
+#include "test_ring_buffer.h"
+#include "test_static_table.h"
+#include "test_static_map.h"
+#include "test_algorithm.h"
 
 void setup() {
     Serial.begin(115200);
@@ -19,6 +36,11 @@ void setup() {
     RUN_TEST(test_set_comparisons);
     RUN_TEST(test_set_capacity_limit);
     RUN_TEST(test_set_copy_constructor);
+    RUN_TEST(test_set_heterogeneous_lookup);
+    RUN_TEST(test_set_bulk_insert);
+    RUN_TEST(test_set_string_insert_erase);
+    RUN_TEST(test_set_algebra);
+    RUN_TEST(test_set_algebra_in_place);
 
     Serial.println("\n=== Running Function Tests ===");
 
@@ -38,6 +60,100 @@ void setup() {
     RUN_TEST(test_function_clear);
     RUN_TEST(test_function_operator_nullptr);
     RUN_TEST(test_function_operator_bool);
+    RUN_TEST(test_function_with_large_capture);
+    RUN_TEST(test_function_with_non_trivial_capture);
+    RUN_TEST(test_function_with_mutable_lambda);
+    RUN_TEST(test_function_heap_fallback);
+    RUN_TEST(test_function_ref);
+    RUN_TEST(test_unique_function_move_only);
+    RUN_TEST(test_unique_function_in_task_queue);
+
+    Serial.println("\n=== Running Map Tests ===");
+
+    RUN_TEST(test_map_find_and_count);
+    RUN_TEST(test_map_heterogeneous_lookup);
+
+    Serial.println("\n=== Running LRU Cache Tests ===");
+
+    RUN_TEST(test_lru_cache_put_get);
+    RUN_TEST(test_lru_cache_evicts_least_recently_used);
+    RUN_TEST(test_lru_cache_erase_and_reuse);
+    RUN_TEST(test_lru_cache_heterogeneous_lookup);
+
+    Serial.println("\n=== Running Bitset Set Tests ===");
+
+    RUN_TEST(test_bitset_set_insert_erase);
+    RUN_TEST(test_bitset_set_iteration_order);
+    RUN_TEST(test_bitset_set_enum_algebra);
+
+    Serial.println("\n=== Running Frozen Set Tests ===");
+
+    RUN_TEST(test_frozen_set_from_set);
+    RUN_TEST(test_frozen_set_lower_bound);
+
+    Serial.println("\n=== Running Signal Tests ===");
+
+    RUN_TEST(test_signal_connect_emit_disconnect);
+    RUN_TEST(test_signal_disconnect_during_emit);
+    RUN_TEST(test_signal_post_flush);
+
+    Serial.println("\n=== Running Timer Wheel Tests ===");
+
+    RUN_TEST(test_timer_wheel_schedule_and_cancel);
+    RUN_TEST(test_timer_wheel_fires_on_deadline);
+    RUN_TEST(test_timer_wheel_reschedule_from_callback);
+    RUN_TEST(test_timer_wheel_rearm_on_full_wheel);
+
+    Serial.println("\n=== Running Pool Tests ===");
+
+    RUN_TEST(test_block_pool_allocate_free);
+    RUN_TEST(test_object_pool_create_destroy);
+    RUN_TEST(test_block_pool_thread_safe_mode);
+
+    Serial.println("\n=== Running Memory Resource Tests ===");
+
+    RUN_TEST(test_arena_containers_with_runtime_capacity);
+    RUN_TEST(test_arena_release_shares_peak);
+    RUN_TEST(test_arena_exhausted_containers);
+    RUN_TEST(test_arena_container_copy_and_move);
+
+    Serial.println("\n=== Running Priority Queue Tests ===");
+
+    RUN_TEST(test_priority_queue_push_pop_order);
+    RUN_TEST(test_priority_queue_handles);
+
+    Serial.println("\n=== Running Intrusive List Tests ===");
+
+    RUN_TEST(test_intrusive_list_push_erase);
+    RUN_TEST(test_intrusive_queue_moves_between_states);
+
+    Serial.println("\n=== Running Inplace String Tests ===");
+
+    RUN_TEST(test_inplace_string_basics);
+    RUN_TEST(test_inplace_string_as_container_key);
+
+    Serial.println("\n=== Running Span Tests ===");
+
+    RUN_TEST(test_span_views_containers);
+    RUN_TEST(test_ring_buffer_spans);
+    RUN_TEST(test_string_view_parsing);
+
+    Serial.println("\n=== Running Container Stats Tests ===");
+
+    RUN_TEST(test_container_stats_counts);
+
+    Serial.println("\n=== Running Ring Buffer Tests ===");
+
+    RUN_TEST(test_ring_buffer_insert_erase_wrapped);
+
+    Serial.println("\n=== Running Static Table Tests ===");
+
+    RUN_TEST(test_static_tables);
+    RUN_TEST(test_static_map_lookup);
+
+    Serial.println("\n=== Running Algorithm Tests ===");
+
+    RUN_TEST(test_algorithm_sort_search_rings);
 
     UNITY_END();
 }
@@ -0,0 +1,67 @@
+#include <unity.h>
+#include "Algorithm.h"
+#include "StaticTable.h"
+
+struct algorithm_reading {
+    uint8_t sensor;
+    int16_t value;
+};
+
+static bool algorithm_by_sensor(const algorithm_reading &a, const algorithm_reading &b) { return a.sensor < b.sensor; }
+
+void test_algorithm_sort_search_rings() {
+    // a ring that wraps around the end of its storage
+    arx::stdx::deque<int, 8> ring;
+    for (int i = 0; i < 6; ++i) ring.push_back(0);
+    for (int i = 0; i < 6; ++i) ring.pop_front();
+    const int values[] = {5, -3, 9, 0, 7, -3, 2};
+    for (int v : values) ring.push_back(v);
+
+    TEST_ASSERT_TRUE(arx::stdx::find(ring, 9) == ring.begin() + 2);
+    TEST_ASSERT_TRUE(arx::stdx::find(ring, 2) == ring.begin() + 6);
+    TEST_ASSERT_TRUE(arx::stdx::find(ring, 4) == ring.end());
+    TEST_ASSERT_EQUAL(2, arx::stdx::nth_element(ring, 3));
+
+    arx::stdx::sort(ring);
+    const int sorted[] = {-3, -3, 0, 2, 5, 7, 9};
+    for (size_t i = 0; i < 7; ++i) TEST_ASSERT_EQUAL(sorted[i], ring[i]);
+
+    // sorted and wrapped again: lower_bound searches both segments
+    ring.pop_front();
+    ring.pop_front();
+    ring.push_back(11);
+    ring.push_back(12);
+    TEST_ASSERT_TRUE(arx::stdx::lower_bound(ring, 6) == ring.begin() + 3);
+    TEST_ASSERT_TRUE(arx::stdx::lower_bound(ring, 12) == ring.begin() + 6);
+    TEST_ASSERT_TRUE(arx::stdx::lower_bound(ring, 13) == ring.end());
+
+    arx::stdx::deque<int, 8> copy = ring;
+    arx::stdx::sort(copy, arx::stdx::greater<int>());
+    TEST_ASSERT_EQUAL(12, copy.front());
+    arx::stdx::radix_sort(copy);
+    for (size_t i = 0; i < copy.size(); ++i) TEST_ASSERT_EQUAL(ring[i], copy[i]);
+
+    // stable: equal sensors keep their order
+    arx::stdx::vector<algorithm_reading, 8> readings;
+    const algorithm_reading raw[] = {{3, 30}, {1, 10}, {3, 31}, {2, 20}, {1, 11}, {3, 32}};
+    for (const auto &r : raw) readings.push_back(r);
+    arx::stdx::vector<algorithm_reading, 8> by_key = readings;
+    arx::stdx::stable_sort(readings, algorithm_by_sensor);
+    arx::stdx::radix_sort(by_key, [](const algorithm_reading &r) { return r.sensor; });
+    const int16_t expected[] = {10, 11, 20, 30, 31, 32};
+    for (size_t i = 0; i < 6; ++i) {
+        TEST_ASSERT_EQUAL(expected[i], readings[i].value);
+        TEST_ASSERT_EQUAL(expected[i], by_key[i].value);
+    }
+
+    uint8_t bytes[] = {'a', 'r', 'x'};
+    TEST_ASSERT_TRUE(arx::stdx::find(bytes, bytes + 3, 'x') == bytes + 2);
+    int carr[] = {4, 1, 3, 2};
+    arx::stdx::sort(carr);
+    TEST_ASSERT_EQUAL(1, carr[0]);
+    TEST_ASSERT_EQUAL(4, carr[3]);
+    arx::static_array<int, 3> table {{7, 5, 6}};
+    arx::stdx::sort(table);
+    TEST_ASSERT_EQUAL(5, table[0]);
+    TEST_ASSERT_TRUE(arx::stdx::lower_bound(table, 6) == table.begin() + 1);
+}
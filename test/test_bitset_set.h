@@ -0,0 +1,49 @@
+#include <unity.h>
+#include "ArxContainer.h"
+#include "BitsetSet.h"
+
+void test_bitset_set_insert_erase() {
+    arx::bitset_set<256> pins;
+
+    TEST_ASSERT_EQUAL(32, sizeof(pins));
+    TEST_ASSERT(pins.insert(13));
+    TEST_ASSERT(pins.insert(2));
+    TEST_ASSERT(pins.insert(255));
+    TEST_ASSERT_FALSE(pins.insert(13));
+    TEST_ASSERT_EQUAL(3, pins.size());
+    TEST_ASSERT(pins.exist(255));
+    TEST_ASSERT_FALSE(pins.exist(14));
+
+    TEST_ASSERT(pins.erase(13));
+    TEST_ASSERT_FALSE(pins.erase(13));
+    TEST_ASSERT_EQUAL(2, pins.size());
+
+    pins.clear();
+    TEST_ASSERT(pins.empty());
+}
+
+void test_bitset_set_iteration_order() {
+    arx::bitset_set<100> set{64, 3, 31, 32, 99, 0};
+    const uint8_t expected[] = {0, 3, 31, 32, 64, 99};
+
+    size_t i = 0;
+    for (uint8_t v: set) {
+        TEST_ASSERT_EQUAL(expected[i], v);
+        ++i;
+    }
+    TEST_ASSERT_EQUAL(6, i);
+}
+
+enum class Channel : uint8_t { A, B, C, D };
+
+void test_bitset_set_enum_algebra() {
+    arx::bitset_set<4, Channel> active{Channel::A, Channel::C};
+    arx::bitset_set<4, Channel> ready{Channel::C, Channel::D};
+
+    TEST_ASSERT((active & ready) == (arx::bitset_set<4, Channel>{Channel::C}));
+    TEST_ASSERT((active | ready).size() == 3);
+    TEST_ASSERT((active - ready) == (arx::bitset_set<4, Channel>{Channel::A}));
+    TEST_ASSERT((active ^ ready) == (arx::bitset_set<4, Channel>{Channel::A, Channel::D}));
+    TEST_ASSERT((active | ready).includes(active));
+    TEST_ASSERT_FALSE(active.includes(ready));
+}
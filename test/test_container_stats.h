@@ -0,0 +1,53 @@
+#include <unity.h>
+#include "ArxContainer.h"
+#include "ContainerStats.h"
+
+void test_container_stats_counts() {
+    arx::stdx::vector<int, 4> v;
+    v.stats_name("v");
+    for (int i = 0; i < 6; ++i) v.push_back(i);
+    v.pop_back();
+
+    arx::stdx::set<int, 2> s;
+    s.insert(1);
+    s.insert(2);
+    s.insert(3);
+    s.exist(1);
+
+    // bulk insert: 8 does not fit into the first chunk, 0 is left over once the set is full
+    arx::stdx::set<int, 4> bulk{1};
+    const int batch[] = {8, 6, 4, 2, 0};
+    bulk.insert(batch, batch + 5);
+    TEST_ASSERT_TRUE(bulk.exist(6));
+    TEST_ASSERT_FALSE(bulk.exist(8));
+
+    const arx::container_stats &vs = v.stats();
+    const arx::container_stats &ss = s.stats();
+#if ARX_CONTAINER_STATS
+    TEST_ASSERT_EQUAL_STRING("v", vs.name);
+    TEST_ASSERT_EQUAL(4, vs.capacity);
+    TEST_ASSERT_EQUAL(3, vs.size);
+    TEST_ASSERT_EQUAL(4, vs.high_water);
+    TEST_ASSERT_EQUAL(6, vs.pushes);
+    TEST_ASSERT_EQUAL(1, vs.pops);
+    TEST_ASSERT_EQUAL(2, vs.overwrites);
+    TEST_ASSERT_EQUAL(2, ss.pushes);
+    TEST_ASSERT_EQUAL(1, ss.drops);
+    TEST_ASSERT_TRUE(ss.lookups > 0);
+    TEST_ASSERT_EQUAL(2, bulk.stats().drops);
+
+    size_t live = 0;
+    arx::for_each_container_stats([&live](const arx::container_stats &) { ++live; });
+    TEST_ASSERT_TRUE(live >= 2);
+
+    v.stats_reset();
+    TEST_ASSERT_EQUAL(0, v.stats().pushes);
+    TEST_ASSERT_EQUAL(3, v.stats().high_water);
+#else
+    // disabled: the counters stay zero and the containers carry no extra state
+    TEST_ASSERT_EQUAL(0, vs.pushes);
+    TEST_ASSERT_EQUAL(0, vs.high_water);
+    TEST_ASSERT_EQUAL(0, ss.lookups);
+    TEST_ASSERT_EQUAL(4 * sizeof(int) + 2 * sizeof(int), sizeof(v));
+#endif
+}
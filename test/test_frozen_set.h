@@ -0,0 +1,30 @@
+#include <unity.h>
+#include "ArxContainer.h"
+#include "FrozenSet.h"
+
+void test_frozen_set_from_set() {
+    arx::stdx::set<int, 16> source{8, 1, 13, 5, 21, 3, 2};
+    arx::frozen_set<int, 16> frozen(source);
+
+    TEST_ASSERT_EQUAL(7, frozen.size());
+    for (int v: source) TEST_ASSERT(frozen.exist(v));
+    TEST_ASSERT_FALSE(frozen.exist(0));
+    TEST_ASSERT_FALSE(frozen.exist(4));
+    TEST_ASSERT_FALSE(frozen.exist(22));
+    TEST_ASSERT(frozen.find(4) == frozen.end());
+    TEST_ASSERT_EQUAL(13, *frozen.find(13));
+}
+
+void test_frozen_set_lower_bound() {
+    const int sorted[] = {10, 20, 30, 40, 50, 60};
+    arx::frozen_set<int, 8> frozen(sorted, sorted + 6);
+
+    TEST_ASSERT_EQUAL(10, *frozen.lower_bound(0));
+    TEST_ASSERT_EQUAL(30, *frozen.lower_bound(21));
+    TEST_ASSERT_EQUAL(60, *frozen.lower_bound(60));
+    TEST_ASSERT(frozen.lower_bound(61) == frozen.end());
+
+    arx::frozen_set<int, 8> empty;
+    TEST_ASSERT(empty.lower_bound(1) == empty.end());
+    TEST_ASSERT_FALSE(empty.exist(1));
+}
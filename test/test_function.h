@@ -1,6 +1,7 @@
 #include <unity.h>
 #include "ArxContainer.h"
 #include "Function.h"
+#include "FunctionRef.h"
 
 void test_function_without_capture() {
     static bool called = false;
@@ -157,3 +158,121 @@ void test_function_operator_bool() {
 
     TEST_ASSERT_FALSE(f);
 }
+
+struct Sum3 {
+    const int *a, *b, *c;
+
+    int operator()() const { return *a + *b + *c; }
+};
+
+void test_function_with_large_capture() {
+    int a = 1, b = 2, c = 3;
+    arx::stdx::inplace_function<int(), 3 * sizeof(void *)> f = [&a, &b, &c]() { return a + b + c; };
+    TEST_ASSERT_EQUAL(6, f());
+
+    using F = arx::stdx::inplace_function<int(), 3 * sizeof(void *)>;
+    TEST_ASSERT_TRUE(F::stored_inline<Sum3>());
+    F g = Sum3{&a, &b, &c};
+    c = 10;
+    TEST_ASSERT_EQUAL(13, g());
+}
+
+void test_function_with_non_trivial_capture() {
+    String name = "sensor";
+    arx::stdx::inplace_function<bool(const String &), sizeof(String)> f = [name](const String &s) { return s == name; };
+
+    arx::stdx::inplace_function<bool(const String &), sizeof(String)> copy = f;
+    arx::stdx::inplace_function<bool(const String &), sizeof(String)> moved = arx::stdx::move(f);
+
+    TEST_ASSERT_TRUE(copy("sensor"));
+    TEST_ASSERT_TRUE(moved("sensor"));
+    TEST_ASSERT_FALSE(moved("other"));
+    TEST_ASSERT_FALSE(static_cast<bool>(f));
+}
+
+void test_function_with_mutable_lambda() {
+    int n = 0;
+    arx::stdx::function<int()> counter = [n]() mutable { return ++n; };
+
+    counter();
+    TEST_ASSERT_EQUAL(2, counter());
+}
+
+void test_function_heap_fallback() {
+#if ARX_FUNCTION_HEAP_FALLBACK
+    String a = "first", b = "second";
+    arx::stdx::function<String()> f = [a, b]() { return a; };
+    arx::stdx::function<String()> copy = f;
+    arx::stdx::function<String()> moved = arx::stdx::move(f);
+
+    TEST_ASSERT_TRUE(copy() == "first");
+    TEST_ASSERT_TRUE(moved() == "first");
+    moved = nullptr;
+    TEST_ASSERT_TRUE(copy() == "first");
+#endif
+}
+
+static int apply_twice(arx::stdx::function_ref<int(int)> f, int x) {
+    return f(f(x));
+}
+
+void test_function_ref() {
+    int offset = 3;
+    TEST_ASSERT_EQUAL(11, apply_twice([&offset](int x) { return x + offset; }, 5));
+    TEST_ASSERT_EQUAL(20, apply_twice(static_func, 5));
+    TEST_ASSERT_EQUAL(13, apply_twice(Functor(), 3));
+
+    arx::stdx::function<int(int)> owned = static_func;
+    TEST_ASSERT_EQUAL(12, apply_twice(owned, 3));
+
+    TEST_ASSERT_EQUAL(2 * sizeof(void *), sizeof(arx::stdx::function_ref<int(int)>));
+}
+
+// owns a counter slot, like a handle that must not be duplicated
+struct UniqueHandle {
+    int *live;
+
+    explicit UniqueHandle(int *live) : live(live) { ++*live; }
+
+    UniqueHandle(UniqueHandle &&r) : live(r.live) { r.live = nullptr; }
+
+    UniqueHandle(const UniqueHandle &) = delete;
+
+    UniqueHandle &operator=(const UniqueHandle &) = delete;
+
+    ~UniqueHandle() {
+        if (live) --*live;
+    }
+
+    int operator()(int x) const { return x + 1; }
+};
+
+void test_unique_function_move_only() {
+    int live = 0;
+    {
+        arx::stdx::unique_function<int(int)> f = UniqueHandle(&live);
+        TEST_ASSERT_EQUAL(1, live);
+        TEST_ASSERT_EQUAL(5, f(4));
+
+        arx::stdx::unique_function<int(int)> g = arx::stdx::move(f);
+        TEST_ASSERT_FALSE(static_cast<bool>(f));
+        TEST_ASSERT_EQUAL(1, live);
+        TEST_ASSERT_EQUAL(3, g(2));
+    }
+    TEST_ASSERT_EQUAL(0, live);
+}
+
+void test_unique_function_in_task_queue() {
+    int live = 0;
+    arx::stdx::deque<arx::stdx::unique_function<int(int)>, 4> tasks;
+    tasks.push_back(UniqueHandle(&live));
+    tasks.push_back(UniqueHandle(&live));
+    TEST_ASSERT_EQUAL(2, live);
+
+    TEST_ASSERT_EQUAL(1, tasks.front()(0));
+    tasks.pop_front();
+    TEST_ASSERT_EQUAL(1, live);  // popping releases the callable
+    tasks.pop_front();
+    TEST_ASSERT_EQUAL(0, live);
+    TEST_ASSERT(tasks.empty());
+}
@@ -0,0 +1,60 @@
+#include <unity.h>
+#include "ArxContainer.h"
+#include "InplaceString.h"
+
+void test_inplace_string_basics() {
+    arx::inplace_string<8> s("motor");
+    TEST_ASSERT_EQUAL(5, s.size());
+    TEST_ASSERT_EQUAL_STRING("motor", s.c_str());
+    TEST_ASSERT_TRUE(s == "motor");
+    TEST_ASSERT_TRUE("motor" == s);
+    TEST_ASSERT_TRUE(s != "motors");
+
+    TEST_ASSERT_FALSE(s.append("_left"));  // truncated to capacity
+    TEST_ASSERT_TRUE(s.full());
+    TEST_ASSERT_EQUAL_STRING("motor_le", s.c_str());
+
+    s = "led";
+    TEST_ASSERT_EQUAL(3, s.size());
+    // padding is zeroed again, so equality over the whole buffer still holds
+    TEST_ASSERT_TRUE(s == arx::inplace_string<8>("led"));
+    s += '1';
+    s.pop_back();
+    s.pop_back();
+    TEST_ASSERT_TRUE(s == arx::inplace_string<8>("le"));
+
+    TEST_ASSERT_TRUE(arx::inplace_string<8>("ab") < arx::inplace_string<8>("abc"));
+    TEST_ASSERT_TRUE(arx::inplace_string<8>("abd") > arx::inplace_string<8>("abc"));
+    TEST_ASSERT_TRUE(arx::inplace_string<8>("abc") < "abd");
+
+    String str("pump");
+    arx::inplace_string<8> from_string(str);
+    TEST_ASSERT_TRUE(from_string == str);
+    TEST_ASSERT_TRUE(str == from_string);
+
+    TEST_ASSERT_EQUAL(arx::stdx::hash<const char *>()("pump"), arx::stdx::hash<arx::inplace_string<8>>()(from_string));
+    TEST_ASSERT_EQUAL(arx::stdx::hash<>()(str), arx::stdx::hash<>()(from_string));
+}
+
+void test_inplace_string_as_container_key() {
+    using Key = arx::inplace_string<16>;
+    arx::stdx::map<Key, int> m;
+    m["temperature"] = 21;
+    m["humidity"] = 40;
+    m.insert("pressure", 1013);
+    TEST_ASSERT_EQUAL(3, m.size());
+    TEST_ASSERT_EQUAL(40, m["humidity"]);
+    TEST_ASSERT_TRUE(m.find("pressure") != m.end());
+    TEST_ASSERT_TRUE(m.find("wind") == m.end());
+
+    arx::stdx::set<Key> s {"b", "c", "a"};
+    TEST_ASSERT_EQUAL_STRING("a", s.begin()->c_str());
+    TEST_ASSERT_TRUE(s.exist("c"));
+
+    // transparent lookup with const char* and String keys
+    arx::stdx::set<Key, 8, arx::stdx::less<>> t {"start", "stop"};
+    TEST_ASSERT_TRUE(t.exist("stop"));
+    arx::stdx::map<Key, int, 8, arx::stdx::equal_to<>> commands {{"start", 1}, {"stop", 2}};
+    TEST_ASSERT_EQUAL(2, commands.at("stop"));
+    TEST_ASSERT_EQUAL(2, commands.at(String("stop")));
+}
@@ -0,0 +1,83 @@
+#include <unity.h>
+#include "ArxContainer.h"
+#include "IntrusiveList.h"
+
+struct HookedJob {
+    int id;
+    arx::list_hook hook;
+    uint8_t payload[32];
+};
+
+using JobList = arx::intrusive_list<HookedJob, &HookedJob::hook>;
+using JobQueue = arx::intrusive_queue<HookedJob, &HookedJob::hook>;
+
+void test_intrusive_list_push_erase() {
+    HookedJob jobs[4];
+    for (int i = 0; i < 4; ++i) jobs[i].id = i;
+
+    JobList list;
+    TEST_ASSERT_TRUE(list.push_back(jobs[1]));
+    TEST_ASSERT_TRUE(list.push_back(jobs[2]));
+    TEST_ASSERT_TRUE(list.push_front(jobs[0]));
+    TEST_ASSERT_FALSE(list.push_back(jobs[0]));  // already linked
+    TEST_ASSERT_EQUAL(3, list.size());
+    TEST_ASSERT_EQUAL(0, list.front().id);
+    TEST_ASSERT_EQUAL(2, list.back().id);
+
+    list.erase(jobs[1]);
+    TEST_ASSERT_FALSE(jobs[1].hook.linked());
+    list.insert(list.iterator_to(jobs[2]), jobs[3]);
+
+    const int expected[] = {0, 3, 2};
+    int n = 0;
+    for (const HookedJob &j : list) TEST_ASSERT_EQUAL(expected[n++], j.id);
+    TEST_ASSERT_EQUAL(3, n);
+
+    JobList::iterator it = list.erase(list.begin());
+    TEST_ASSERT_EQUAL(3, it->id);
+    TEST_ASSERT_EQUAL(2, list.pop_back()->id);
+    TEST_ASSERT_EQUAL(3, list.pop_front()->id);
+    TEST_ASSERT_NULL(list.pop_front());
+    TEST_ASSERT_TRUE(list.empty());
+
+    // a copy of a linked object is not linked
+    list.push_back(jobs[0]);
+    HookedJob copy = jobs[0];
+    TEST_ASSERT_FALSE(copy.hook.linked());
+    list.clear();
+    TEST_ASSERT_FALSE(jobs[0].hook.linked());
+}
+
+void test_intrusive_queue_moves_between_states() {
+    static HookedJob jobs[8];
+    JobQueue idle, pending;
+    JobList in_flight;
+    for (int i = 0; i < 8; ++i) {
+        jobs[i].id = i;
+        idle.push(jobs[i]);
+    }
+
+    for (int i = 0; i < 3; ++i) pending.push(*idle.pop());
+    TEST_ASSERT_EQUAL(5, idle.size());
+    TEST_ASSERT_EQUAL(0, pending.front().id);
+
+    in_flight.push_back(*pending.pop());
+    in_flight.push_back(*pending.pop());
+    TEST_ASSERT_EQUAL(1, pending.size());
+
+    // job 1 finished out of order: straight back to idle
+    idle.push(in_flight.erase(jobs[1]));
+    TEST_ASSERT_EQUAL(1, idle.back().id);
+
+    in_flight.splice(in_flight.end(), pending, jobs[2]);
+    TEST_ASSERT_TRUE(pending.empty());
+    TEST_ASSERT_EQUAL(2, in_flight.size());
+
+    // everything in flight is done at once
+    idle.splice(idle.end(), in_flight);
+    TEST_ASSERT_TRUE(in_flight.empty());
+    TEST_ASSERT_EQUAL(8, idle.size());
+    const int expected[] = {3, 4, 5, 6, 7, 1, 0, 2};
+    for (int e : expected) TEST_ASSERT_EQUAL(e, idle.pop()->id);
+    TEST_ASSERT_NULL(idle.pop());
+}
@@ -0,0 +1,69 @@
+#include <unity.h>
+#include "ArxContainer.h"
+#include "LruCache.h"
+
+void test_lru_cache_put_get() {
+    arx::lru_cache<int, int, 3> cache;
+    cache.put(1, 10);
+    cache.put(2, 20);
+
+    TEST_ASSERT_EQUAL(2, cache.size());
+    TEST_ASSERT_NOT_NULL(cache.get(1));
+    TEST_ASSERT_EQUAL(10, *cache.get(1));
+    TEST_ASSERT_NULL(cache.get(3));
+
+    cache.put(1, 11);
+    TEST_ASSERT_EQUAL(2, cache.size());
+    TEST_ASSERT_EQUAL(11, *cache.peek(1));
+}
+
+void test_lru_cache_evicts_least_recently_used() {
+    static int evicted_key;
+    static int evicted_value;
+    evicted_key = evicted_value = -1;
+
+    arx::lru_cache<int, int, 3> cache;
+    cache.on_evict([](const int &k, int &v) {
+        evicted_key = k;
+        evicted_value = v;
+    });
+    cache.put(1, 10);
+    cache.put(2, 20);
+    cache.put(3, 30);
+    cache.get(1);  // 2 is now the least recently used
+    cache.put(4, 40);
+
+    TEST_ASSERT_EQUAL(2, evicted_key);
+    TEST_ASSERT_EQUAL(20, evicted_value);
+    TEST_ASSERT_EQUAL(3, cache.size());
+    TEST_ASSERT_FALSE(cache.contains(2));
+    TEST_ASSERT_TRUE(cache.contains(1));
+    TEST_ASSERT_EQUAL(3, *cache.lru_key());
+}
+
+void test_lru_cache_erase_and_reuse() {
+    arx::lru_cache<int, int, 4> cache;
+    for (int i = 0; i < 4; ++i) cache.put(i, i * 10);
+
+    TEST_ASSERT_TRUE(cache.erase(1));
+    TEST_ASSERT_FALSE(cache.erase(1));
+    TEST_ASSERT_EQUAL(3, cache.size());
+
+    // churn through the table to exercise probing and backward-shift deletion
+    for (int i = 10; i < 200; ++i) {
+        cache.put(i, i);
+        TEST_ASSERT_EQUAL(i, *cache.get(i));
+    }
+    TEST_ASSERT_EQUAL(4, cache.size());
+    for (int i = 196; i < 200; ++i) TEST_ASSERT_TRUE(cache.contains(i));
+}
+
+void test_lru_cache_heterogeneous_lookup() {
+    arx::lru_cache<String, int, 2, arx::stdx::hash<>, arx::stdx::equal_to<>> cache;
+    cache.put("dns", 1);
+
+    TEST_ASSERT_TRUE(cache.contains("dns"));
+    TEST_ASSERT_EQUAL(1, *cache.get("dns"));
+    TEST_ASSERT_TRUE(cache.erase("dns"));
+    TEST_ASSERT_TRUE(cache.empty());
+}
@@ -0,0 +1,30 @@
+#include <unity.h>
+#include "ArxContainer.h"
+#include "Map.h"
+
+void test_map_find_and_count() {
+    arx::stdx::map<int, int, 4> mp{{1, 10}, {2, 20}};
+
+    TEST_ASSERT(mp.find(1) != mp.end());
+    TEST_ASSERT_EQUAL(20, mp.find(2)->second);
+    TEST_ASSERT(mp.find(3) == mp.end());
+    TEST_ASSERT_EQUAL(1, mp.count(1));
+    TEST_ASSERT_EQUAL(0, mp.count(3));
+}
+
+void test_map_heterogeneous_lookup() {
+    arx::stdx::map<String, int, 4, arx::stdx::equal_to<>> commands{{"start", 1}, {"stop", 2}};
+
+    TEST_ASSERT_EQUAL(1, commands.count("start"));
+    TEST_ASSERT_EQUAL(0, commands.count("reset"));
+    TEST_ASSERT_EQUAL(2, commands.find("stop")->second);
+    TEST_ASSERT_EQUAL(1, commands.at("start"));
+
+    commands.erase("start");
+    TEST_ASSERT_EQUAL(1, commands.size());
+    TEST_ASSERT(commands.find("start") == commands.end());
+
+    // erase by index is still available on transparent maps
+    commands.erase(static_cast<size_t>(0));
+    TEST_ASSERT(commands.empty());
+}
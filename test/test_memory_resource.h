@@ -0,0 +1,118 @@
+#include <unity.h>
+#include "ArxContainer.h"
+#include "MemoryResource.h"
+
+void test_arena_containers_with_runtime_capacity() {
+    arx::arena<512> arena;
+
+    arx::pmr::vector<int> v(8, arena);
+    TEST_ASSERT_EQUAL(8, v.capacity());
+    for (int i = 0; i < 10; ++i) v.push_back(i);  // full: the oldest are dropped, as with a fixed N
+    TEST_ASSERT_EQUAL(8, v.size());
+    TEST_ASSERT_EQUAL(2, v.front());
+    TEST_ASSERT_EQUAL(9, v.back());
+
+    arx::pmr::map<int, int> m(4, arena);
+    m[3] = 30;
+    m[1] = 10;
+    TEST_ASSERT_EQUAL(2, m.size());
+    TEST_ASSERT_EQUAL(30, m[3]);
+    TEST_ASSERT_TRUE(m.find(1) != m.end());
+
+    arx::pmr::set<int> s(4, arena);
+    const int values[] = {5, 1, 4, 1, 9, 2};
+    s.insert(values, values + 6);
+    TEST_ASSERT_EQUAL(4, s.size());
+    TEST_ASSERT_EQUAL(1, *s.begin());
+    TEST_ASSERT_TRUE(s.exist(5));
+    TEST_ASSERT_FALSE(s.insert(7));
+
+    arx::pmr::deque<int> d(3, arena);
+    d.push_front(2);
+    d.push_front(1);
+    d.push_back(3);
+    TEST_ASSERT_EQUAL(1, d.front());
+    TEST_ASSERT_EQUAL(3, d.back());
+
+    TEST_ASSERT_TRUE(arena.used() >= 8 * sizeof(int) + 4 * sizeof(int) + 3 * sizeof(int));
+}
+
+void test_arena_release_shares_peak() {
+    arx::arena<256> arena;
+
+    for (int request = 0; request < 5; ++request) {
+        {
+            arx::pmr::vector<int> a(16, arena);
+            arx::pmr::set<int> b(16, arena);
+            for (int i = 0; i < 16; ++i) {
+                a.push_back(i);
+                b.insert(request * 100 + i);
+            }
+            TEST_ASSERT_EQUAL(16, a.size());
+            TEST_ASSERT_EQUAL(16, b.size());
+        }
+        // destroyed in reverse order, so the arena is empty again even before release()
+        TEST_ASSERT_EQUAL(0, arena.used());
+        arena.release();
+    }
+    TEST_ASSERT_EQUAL(32 * sizeof(int), arena.peak());
+
+    // out of memory: the container gets no capacity and ignores pushes
+    arx::pmr::vector<int> big(1000, arena);
+    TEST_ASSERT_EQUAL(0, big.capacity());
+    big.push_back(1);
+    TEST_ASSERT_TRUE(big.empty());
+}
+
+void test_arena_exhausted_containers() {
+    // the arena runs out: the containers have no capacity, and store and return nothing
+    arx::arena<16 * sizeof(int)> arena;
+    arx::pmr::vector<int> filler(16, arena);
+    TEST_ASSERT_EQUAL(0, arena.remaining());
+
+    arx::pmr::map<int, int> m(4, arena);
+    m[3] = 4;
+    TEST_ASSERT_EQUAL(0, m.size());
+    TEST_ASSERT_TRUE(m.find(3) == m.end());
+    TEST_ASSERT_EQUAL(0, m[3]);
+    TEST_ASSERT_FALSE(m.insert(5, 6).second);
+
+    arx::pmr::vector<int> v(4, arena);
+    v.push_back(1);
+    TEST_ASSERT_TRUE(v.empty());
+    TEST_ASSERT_EQUAL(0, v.front());
+    TEST_ASSERT_EQUAL(0, v.back());
+    TEST_ASSERT_TRUE(v.begin() == v.end());
+
+    arx::pmr::deque<int> d(4, arena);
+    d.push_front(1);
+    TEST_ASSERT_EQUAL(0, d.front());
+}
+
+void test_arena_container_copy_and_move() {
+    arx::arena<256> arena;
+
+    arx::pmr::vector<int> a(4, arena);
+    a.push_back(1);
+    a.push_back(2);
+
+    arx::pmr::vector<int> copy(a);
+    TEST_ASSERT_EQUAL(4, copy.capacity());
+    TEST_ASSERT_EQUAL(2, copy.size());
+    TEST_ASSERT_EQUAL(2, copy[1]);
+    copy[1] = 20;
+    TEST_ASSERT_EQUAL(2, a[1]);
+
+    const size_t used = arena.used();
+    arx::pmr::vector<int> moved(arx::stdx::move(a));
+    TEST_ASSERT_EQUAL(used, arena.used());  // the buffer is taken over, not reallocated
+    TEST_ASSERT_EQUAL(2, moved.size());
+    TEST_ASSERT_EQUAL(0, a.capacity());
+
+    arx::pmr::set<int> s(3, arena);
+    s.insert(3);
+    s.insert(1);
+    arx::pmr::set<int> t(3, arena);
+    t = s;
+    TEST_ASSERT_TRUE(t == s);
+}
@@ -0,0 +1,92 @@
+#include <unity.h>
+#include "ArxContainer.h"
+#include "Pool.h"
+
+void test_block_pool_allocate_free() {
+    ArxBlockPool<24, 3> pool;  // the global alias
+    TEST_ASSERT_EQUAL(3, pool.available());
+
+    void *a = pool.allocate();
+    void *b = pool.allocate(16);
+    void *c = pool.allocate(24);
+    TEST_ASSERT_NOT_NULL(a);
+    TEST_ASSERT_NOT_NULL(b);
+    TEST_ASSERT_NOT_NULL(c);
+    TEST_ASSERT_TRUE(a != b && b != c && a != c);
+    TEST_ASSERT_EQUAL(0, (uintptr_t)a % alignof(void *));
+    TEST_ASSERT_TRUE(pool.full());
+    TEST_ASSERT_NULL(pool.allocate());
+    TEST_ASSERT_EQUAL(1, pool.failures());
+
+    TEST_ASSERT_TRUE(pool.owns(b));
+    int local;
+    TEST_ASSERT_FALSE(pool.owns(&local));
+
+    pool.deallocate(b);
+    TEST_ASSERT_EQUAL(2, pool.size());
+    TEST_ASSERT_EQUAL(b, pool.allocate());  // most recently freed block is reused first
+    TEST_ASSERT_NULL(pool.allocate(25));
+
+    pool.deallocate(a);
+    pool.deallocate(b);
+    pool.deallocate(c);
+    TEST_ASSERT_TRUE(pool.empty());
+    TEST_ASSERT_EQUAL(3, pool.high_water());
+}
+
+struct PooledMessage {
+    static int alive;
+    uint8_t topic;
+    int32_t value;
+
+    PooledMessage(uint8_t topic, int32_t value) : topic(topic), value(value) { ++alive; }
+
+    ~PooledMessage() { --alive; }
+};
+
+int PooledMessage::alive = 0;
+
+void test_object_pool_create_destroy() {
+    ArxObjectPool<PooledMessage, 4> pool;  // the global alias
+    PooledMessage *msgs[4];
+    for (int i = 0; i < 4; ++i) msgs[i] = pool.create(i, i * 100);
+    TEST_ASSERT_NULL(pool.create(9, 9));
+    TEST_ASSERT_EQUAL(4, PooledMessage::alive);
+    TEST_ASSERT_EQUAL(300, msgs[3]->value);
+
+    pool.destroy(msgs[1]);
+    pool.destroy(msgs[2]);
+    TEST_ASSERT_EQUAL(2, PooledMessage::alive);
+    TEST_ASSERT_EQUAL(2, pool.available());
+
+    PooledMessage *m = pool.create(7, 700);
+    TEST_ASSERT_TRUE(pool.owns(m));
+    TEST_ASSERT_EQUAL(7, m->topic);
+    pool.destroy(m);
+    pool.destroy(msgs[0]);
+    pool.destroy(msgs[3]);
+    TEST_ASSERT_EQUAL(0, PooledMessage::alive);
+    TEST_ASSERT_EQUAL(4, pool.high_water());
+}
+
+void test_block_pool_thread_safe_mode() {
+    // same behaviour through the ISR-safe free list
+    arx::block_pool<8, 2, true> pool;
+    void *a = pool.allocate();
+    void *b = pool.allocate();
+    TEST_ASSERT_NULL(pool.allocate());
+    pool.deallocate(a);
+    TEST_ASSERT_EQUAL(a, pool.allocate());
+    pool.deallocate(a);
+    pool.deallocate(b);
+    TEST_ASSERT_TRUE(pool.empty());
+    TEST_ASSERT_EQUAL(2, pool.high_water());
+    TEST_ASSERT_EQUAL(1, pool.failures());
+
+    // the failure count saturates instead of wrapping
+    arx::block_pool<8, 1, true> single;
+    void *only = single.allocate();
+    for (uint32_t i = 0; i < 0x10000UL; ++i) single.allocate();
+    TEST_ASSERT_EQUAL(0xFFFF, single.failures());
+    single.deallocate(only);
+}
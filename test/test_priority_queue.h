@@ -0,0 +1,64 @@
+#include <unity.h>
+#include "ArxContainer.h"
+#include "PriorityQueue.h"
+
+void test_priority_queue_push_pop_order() {
+    arx::stdx::priority_queue<int, 8> q {5, 1, 9};
+    const int values[] = {7, 3, 9, 2, 8};
+    for (int v : values) q.push(v);
+    TEST_ASSERT_TRUE(q.full());
+    TEST_ASSERT_FALSE(q.push(100).valid());
+
+    const int expected[] = {9, 9, 8, 7, 5, 3, 2, 1};
+    for (int e : expected) {
+        TEST_ASSERT_EQUAL(e, q.top());
+        q.pop();
+    }
+    TEST_ASSERT_TRUE(q.empty());
+
+    // 4-ary min-heap
+    arx::stdx::priority_queue<int, 8, arx::stdx::greater<int>, 4> mq;
+    for (int v : values) mq.push(v);
+    TEST_ASSERT_EQUAL(2, mq.top());
+    mq.pop();
+    TEST_ASSERT_EQUAL(3, mq.top());
+}
+
+void test_priority_queue_handles() {
+    // scheduler-style min-heap of deadlines
+    arx::stdx::priority_queue<uint32_t, 16, arx::stdx::greater<uint32_t>> q;
+    using handle = decltype(q)::handle;
+    handle h[10];
+    for (uint32_t i = 0; i < 10; ++i) h[i] = q.push(100 + i * 10);
+    TEST_ASSERT_EQUAL(100, q.top());
+
+    TEST_ASSERT_TRUE(q.decrease_key(h[7], 50));
+    TEST_ASSERT_EQUAL(50, q.top());
+    TEST_ASSERT_EQUAL(50, *q.get(h[7]));
+
+    TEST_ASSERT_TRUE(q.update(h[7], 500));  // pushed back down
+    TEST_ASSERT_EQUAL(100, q.top());
+
+    TEST_ASSERT_TRUE(q.erase(h[0]));
+    TEST_ASSERT_FALSE(h[0].valid());
+    TEST_ASSERT_EQUAL(110, q.top());
+    TEST_ASSERT_EQUAL(9, q.size());
+
+    // a popped element's handle is stale, even after its slot is reused
+    handle top = h[1];
+    q.pop();
+    TEST_ASSERT_FALSE(q.contains(top));
+    handle reused = q.push(1);
+    TEST_ASSERT_EQUAL(top.index, reused.index);
+    TEST_ASSERT_FALSE(q.contains(top));
+    TEST_ASSERT_NULL(q.get(top));
+    TEST_ASSERT_FALSE(q.update(top, 0));
+
+    uint32_t last = 0;
+    while (!q.empty()) {
+        TEST_ASSERT_TRUE(q.top() >= last);
+        last = q.top();
+        q.pop();
+    }
+    TEST_ASSERT_EQUAL(500, last);
+}
@@ -0,0 +1,27 @@
+#include <unity.h>
+#include "ArxContainer.h"
+
+void test_ring_buffer_insert_erase_wrapped() {
+    arx::stdx::deque<int, 6> d;
+    for (int i = 0; i < 8; ++i) d.push_back(i);  // 2..7, wrapped around the end of the storage
+    const int more[] = {10, 11};
+    d.insert(d.begin() + 1, more, more + 2);     // elements moved past the capacity are dropped
+    const int expected[] = {2, 10, 11, 3, 4, 5};
+    TEST_ASSERT_EQUAL(6, d.size());
+    for (size_t i = 0; i < d.size(); ++i) TEST_ASSERT_EQUAL(expected[i], d[i]);
+
+    d.erase(d.begin() + 1);
+    d.erase(d.begin() + 1);
+    TEST_ASSERT_EQUAL(4, d.size());
+    TEST_ASSERT_EQUAL(3, d[1]);
+    TEST_ASSERT_EQUAL(5, d.back());
+
+    d.insert(d.end(), more, more + 2);  // pushed back
+    TEST_ASSERT_EQUAL(11, d.back());
+    TEST_ASSERT_EQUAL(6, d.size());
+
+    arx::stdx::vector<int, 4> empty;
+    empty.insert(empty.begin(), more, more + 2);
+    TEST_ASSERT_EQUAL(2, empty.size());
+    TEST_ASSERT_EQUAL(10, empty[0]);
+}
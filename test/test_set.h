@@ -151,4 +151,126 @@ void ASSERT_ORDER(const arx::stdx::set<int, N> &set) {
         TEST_ASSERT_MESSAGE(last < e, "Set should be ordered");
         last = e;
     }
-}
\ No newline at end of file
+}
+void test_set_heterogeneous_lookup() {
+    arx::stdx::set<String, 5, arx::stdx::less<>> names{"stop", "go", "reset"};
+
+    TEST_ASSERT(names.exist("go"));
+    TEST_ASSERT_FALSE(names.exist("halt"));
+    TEST_ASSERT_EQUAL(1, names.count("reset"));
+    TEST_ASSERT(names.find("stop") != names.end());
+    TEST_ASSERT(names.find("halt") == names.end());
+
+    TEST_ASSERT(names.erase("go"));
+    TEST_ASSERT_EQUAL(2, names.size());
+    TEST_ASSERT_FALSE(names.exist("go"));
+}
+
+void test_set_bulk_insert() {
+    arx::stdx::set<int, 8> set{2, 6};
+    const int batch[] = {7, 1, 6, 4, 1, 9};
+    set.insert(batch, batch + 6);
+
+    TEST_ASSERT_EQUAL(6, set.size());
+    TEST_ASSERT(set.exist(1));
+    TEST_ASSERT(set.exist(4));
+    TEST_ASSERT(set.exist(9));
+    ASSERT_ORDER(set);
+
+    // only the smallest new values are kept once the set is full
+    const int more[] = {10, 0, 3, 2};
+    set.insert(more, more + 4);
+    TEST_ASSERT_EQUAL(8, set.size());
+    TEST_ASSERT(set.exist(0));
+    TEST_ASSERT(set.exist(3));
+    TEST_ASSERT_FALSE(set.exist(10));
+    ASSERT_ORDER(set);
+
+    // larger batches are merged in several chunks
+    arx::stdx::set<int, 64> wide;
+    int descending[40];
+    for (int i = 0; i < 40; ++i) descending[i] = 80 - 2 * i;
+    wide.insert(descending, descending + 40);
+    TEST_ASSERT_EQUAL(40, wide.size());
+    TEST_ASSERT_EQUAL(2, *wide.begin());
+    TEST_ASSERT(wide.exist(42));
+    ASSERT_ORDER(wide);
+}
+
+void test_set_string_insert_erase() {
+    arx::stdx::set<String, 4> set;
+    set.insert("b");
+    set.insert("d");
+    set.insert("a");
+    set.insert("c");
+
+    TEST_ASSERT(*set.begin() == "a");
+    TEST_ASSERT(set.erase("b"));
+    TEST_ASSERT_EQUAL(3, set.size());
+    TEST_ASSERT(set.begin()[1] == "c");
+    TEST_ASSERT(set.insert("b"));
+    TEST_ASSERT(set.begin()[1] == "b");
+}
+
+void test_set_algebra() {
+    arx::stdx::set<int, 8> a{1, 3, 5, 7, 9};
+    arx::stdx::set<int, 8> b{3, 4, 5, 6, 7};
+    arx::stdx::set<int, 8> out;
+
+    TEST_ASSERT(arx::stdx::set_union(a, b, out));
+    TEST_ASSERT((out == arx::stdx::set<int, 8>{1, 3, 4, 5, 6, 7, 9}));
+
+    TEST_ASSERT(arx::stdx::set_intersection(a, b, out));
+    TEST_ASSERT((out == arx::stdx::set<int, 8>{3, 5, 7}));
+
+    TEST_ASSERT(arx::stdx::set_difference(a, b, out));
+    TEST_ASSERT((out == arx::stdx::set<int, 8>{1, 9}));
+
+    TEST_ASSERT(arx::stdx::set_symmetric_difference(a, b, out));
+    TEST_ASSERT((out == arx::stdx::set<int, 8>{1, 4, 6, 9}));
+
+    TEST_ASSERT(arx::stdx::includes(a, arx::stdx::set<int, 8>{3, 9}));
+    TEST_ASSERT_FALSE(arx::stdx::includes(a, b));
+
+    arx::stdx::set<int, 4> small;
+    TEST_ASSERT_FALSE(arx::stdx::set_union(a, b, small));
+    TEST_ASSERT((small == arx::stdx::set<int, 4>{1, 3, 4, 5}));
+
+    // long runs of 8- and 16-bit ids (the block compare on SSE2 targets)
+    arx::stdx::set<uint8_t, 64> even, triple, ids;
+    arx::stdx::set<int16_t, 64> even16, triple16, ids16;
+    for (int k = 0; k < 64; ++k) {
+        even.insert(static_cast<uint8_t>(2 * k));
+        triple.insert(static_cast<uint8_t>(3 * k));
+        even16.insert(static_cast<int16_t>(2 * k - 64));
+        triple16.insert(static_cast<int16_t>(3 * k - 90));
+    }
+    TEST_ASSERT(arx::stdx::set_intersection(even, triple, ids));
+    TEST_ASSERT(arx::stdx::set_intersection(even16, triple16, ids16));
+    TEST_ASSERT_EQUAL(22, ids.size());   // 0, 6, ..., 126
+    TEST_ASSERT_EQUAL(21, ids16.size()); // -60, -54, ..., 60
+    for (size_t k = 0; k < ids.size(); ++k) TEST_ASSERT_EQUAL(6 * k, ids.begin()[k]);
+    for (size_t k = 0; k < ids16.size(); ++k) TEST_ASSERT_EQUAL(6 * static_cast<int>(k) - 60, ids16.begin()[k]);
+    even &= triple;
+    TEST_ASSERT(even == ids);
+}
+
+void test_set_algebra_in_place() {
+    arx::stdx::set<int, 8> a{1, 3, 5, 7, 9};
+    const arx::stdx::set<int, 8> b{3, 4, 5, 6, 7};
+
+    arx::stdx::set<int, 8> u = a;
+    u |= b;
+    TEST_ASSERT((u == arx::stdx::set<int, 8>{1, 3, 4, 5, 6, 7, 9}));
+
+    arx::stdx::set<int, 8> i = a;
+    i &= b;
+    TEST_ASSERT((i == arx::stdx::set<int, 8>{3, 5, 7}));
+
+    arx::stdx::set<int, 8> d = a;
+    d -= b;
+    TEST_ASSERT((d == arx::stdx::set<int, 8>{1, 9}));
+
+    a ^= b;
+    TEST_ASSERT((a == arx::stdx::set<int, 8>{1, 4, 6, 9}));
+}
@@ -0,0 +1,86 @@
+#include <unity.h>
+#include "ArxContainer.h"
+#include "Signal.h"
+
+void test_signal_connect_emit_disconnect() {
+    static int sum;
+    sum = 0;
+
+    arx::signal<void(int), 3> sig;
+    auto a = sig.connect([](int v) { sum += v; });
+    auto b = sig.connect([](int v) { sum += v * 10; });
+    TEST_ASSERT_TRUE(a.valid());
+    TEST_ASSERT_EQUAL(2, sig.size());
+
+    sig.emit(1);
+    TEST_ASSERT_EQUAL(11, sum);
+
+    TEST_ASSERT_TRUE(sig.disconnect(a));
+    TEST_ASSERT_FALSE(sig.disconnect(a));
+    TEST_ASSERT_FALSE(a.valid());
+    sig(2);
+    TEST_ASSERT_EQUAL(31, sum);
+
+    // the freed slot is reused, and a stale handle to it stays disconnected
+    auto stale = b;
+    TEST_ASSERT_TRUE(sig.disconnect(b));
+    auto c = sig.connect([](int v) { sum -= v; });
+    auto d = sig.connect([](int v) { sum -= v; });
+    auto e = sig.connect([](int v) { sum -= v; });
+    TEST_ASSERT_TRUE(c.valid() && d.valid() && e.valid());
+    TEST_ASSERT_FALSE(sig.connected(stale));
+    TEST_ASSERT_FALSE(sig.disconnect(stale));
+    TEST_ASSERT_FALSE(sig.connect([](int) {}).valid());
+    TEST_ASSERT_EQUAL(3, sig.size());
+}
+
+void test_signal_disconnect_during_emit() {
+    static arx::signal<void()> *sig;
+    static arx::signal<void()>::connection self, other;
+    static int calls_self, calls_other, calls_added;
+    calls_self = calls_other = calls_added = 0;
+
+    arx::signal<void()> s;
+    sig = &s;
+    self = s.connect([]() {
+        ++calls_self;
+        sig->disconnect(self);
+        sig->disconnect(other);
+        sig->connect([]() { ++calls_added; });
+    });
+    other = s.connect([]() { ++calls_other; });
+
+    s.emit();
+    TEST_ASSERT_EQUAL(1, calls_self);
+    TEST_ASSERT_EQUAL(0, calls_other);
+    TEST_ASSERT_EQUAL(0, calls_added);  // connected during emission: not called until the next emit
+    TEST_ASSERT_EQUAL(1, s.size());
+
+    s.emit();
+    TEST_ASSERT_EQUAL(1, calls_self);
+    TEST_ASSERT_EQUAL(1, calls_added);
+}
+
+void test_signal_post_flush() {
+    static int total, last_id;
+    total = last_id = 0;
+
+    arx::signal<void(int, const long &), 2, 3> sig;
+    sig.connect([](int id, const long &value) {
+        last_id = id;
+        total += (int)value;
+    });
+
+    TEST_ASSERT_TRUE(sig.post(1, 100));
+    TEST_ASSERT_TRUE(sig.post(2, 20));
+    TEST_ASSERT_TRUE(sig.post(3, 3));
+    TEST_ASSERT_FALSE(sig.post(4, 4));
+    TEST_ASSERT_EQUAL(3, sig.pending());
+    TEST_ASSERT_EQUAL(0, total);
+
+    TEST_ASSERT_EQUAL(3, sig.flush());
+    TEST_ASSERT_EQUAL(123, total);
+    TEST_ASSERT_EQUAL(3, last_id);
+    TEST_ASSERT_EQUAL(0, sig.pending());
+    TEST_ASSERT_EQUAL(0, sig.flush());
+}
@@ -0,0 +1,88 @@
+#include <unity.h>
+#include "ArxContainer.h"
+#include "Span.h"
+#include "StringView.h"
+#include "InplaceString.h"
+
+static uint16_t span_checksum(arx::stdx::span<const uint8_t> bytes) {
+    uint16_t sum = 0;
+    for (uint8_t b : bytes) sum += b;
+    return sum;
+}
+
+void test_span_views_containers() {
+    uint8_t raw[6] = {1, 2, 3, 4, 5, 6};
+    arx::stdx::span<uint8_t> s(raw);
+    TEST_ASSERT_EQUAL(6, s.size());
+    TEST_ASSERT_EQUAL(21, span_checksum(s));
+    TEST_ASSERT_EQUAL(7, span_checksum(s.subspan(2, 2)));
+    TEST_ASSERT_EQUAL(11, span_checksum(s.last(2)));
+    TEST_ASSERT_EQUAL(3, span_checksum(s.first(2)));
+    TEST_ASSERT_TRUE(s.subspan(10).empty());
+    s[0] = 10;
+    TEST_ASSERT_EQUAL(10, raw[0]);
+
+    arx::stdx::vector<uint8_t, 8> v {1, 2, 3};
+    TEST_ASSERT_EQUAL(6, span_checksum(v));
+
+    arx::stdx::set<int> set {3, 1, 2};
+    arx::stdx::span<const int> sorted(set);
+    TEST_ASSERT_EQUAL(3, sorted.size());
+    TEST_ASSERT_EQUAL(1, sorted.front());
+    TEST_ASSERT_EQUAL(3, sorted.back());
+
+    const uint32_t word = 0x01010101;
+    TEST_ASSERT_EQUAL(4, span_checksum(arx::stdx::as_bytes(arx::stdx::span<const uint32_t>(&word, 1))));
+}
+
+void test_ring_buffer_spans() {
+    arx::stdx::vector<int, 4> v;
+    for (int i = 1; i <= 6; ++i) v.push_back(i);  // 3..6, wrapped around the end of the storage
+
+    auto parts = v.spans();
+    TEST_ASSERT_EQUAL(4, parts.first.size() + parts.second.size());
+    TEST_ASSERT_EQUAL(2, parts.second.size());
+    TEST_ASSERT_EQUAL(3, parts.first[0]);
+    TEST_ASSERT_EQUAL(6, parts.second[1]);
+
+    // conversion to one span puts the elements back in one piece
+    arx::stdx::span<int> all(v);
+    TEST_ASSERT_EQUAL(4, all.size());
+    for (int i = 0; i < 4; ++i) TEST_ASSERT_EQUAL(3 + i, all[i]);
+    TEST_ASSERT_EQUAL(3, v.front());
+    TEST_ASSERT_EQUAL(6, v.back());
+    TEST_ASSERT_TRUE(v.spans().second.empty());
+
+    arx::stdx::deque<int, 4> d;
+    d.push_back(2);
+    d.push_front(1);  // lands at the end of the storage
+    const arx::stdx::deque<int, 4> &cd = d;
+    TEST_ASSERT_EQUAL(1, cd.spans().first.size());
+    TEST_ASSERT_EQUAL(1, cd.spans().second.size());
+    TEST_ASSERT_EQUAL(2, d.linearize()[1]);
+
+    arx::stdx::vector<int, 4> empty;
+    TEST_ASSERT_TRUE(arx::stdx::span<const int>(empty).empty());
+}
+
+void test_string_view_parsing() {
+    const char line[] = "SET motor=120;extra";
+    arx::stdx::string_view sv(line, 13);  // no terminator at the end of the view
+    TEST_ASSERT_TRUE(sv.starts_with("SET "));
+    TEST_ASSERT_TRUE(sv.ends_with("120"));
+    sv.remove_prefix(4);
+
+    const size_t eq = sv.find('=');
+    TEST_ASSERT_EQUAL(5, eq);
+    TEST_ASSERT_TRUE(sv.substr(0, eq) == "motor");
+    TEST_ASSERT_TRUE(sv.substr(eq + 1) == "120");
+    TEST_ASSERT_EQUAL(2, sv.find("to"));
+    TEST_ASSERT_EQUAL(arx::stdx::string_view::npos, sv.find("extra"));
+
+    arx::inplace_string<8> key("motor");
+    TEST_ASSERT_TRUE(arx::stdx::string_view(key) == sv.substr(0, eq));
+    TEST_ASSERT_TRUE(arx::stdx::string_view(String("mot")) < sv);
+    TEST_ASSERT_EQUAL(arx::stdx::hash<const char *>()("motor"), arx::stdx::hash<arx::stdx::string_view>()(sv.substr(0, eq)));
+    TEST_ASSERT_TRUE(arx::stdx::string_view().empty());
+    TEST_ASSERT_TRUE(arx::stdx::string_view() == "");
+}
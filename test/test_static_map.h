@@ -0,0 +1,41 @@
+#include <unity.h>
+#include "StaticMap.h"
+
+// a table in RAM, read with find() / exist() / value_or()
+static const auto static_commands = arx::make_static_map<const char *, uint8_t>({
+        {"start", 1}, {"stop", 2}, {"reset", 3}, {"status", 4}, {"led", 5}});
+
+#if __cplusplus >= 201402L
+// hashed and placed by the compiler into flash on AVR, read with the _P accessors
+static constexpr auto static_commands_P PROGMEM = arx::make_static_map<const char *, uint8_t>({
+        {"start", 1}, {"stop", 2}, {"reset", 3}, {"status", 4}, {"led", 5}});
+static_assert(static_commands_P.valid() && static_commands_P.value_or("reset", 0) == 3, "perfect hash at compile time");
+#endif
+
+void test_static_map_lookup() {
+    TEST_ASSERT_TRUE(static_commands.valid());
+    const char stop[] = "stop";
+    TEST_ASSERT_EQUAL(2, static_commands.value_or(stop, 0));
+    TEST_ASSERT_FALSE(static_commands.exist("stap"));
+    TEST_ASSERT_EQUAL(5, static_commands.find("led")->second);
+    TEST_ASSERT_TRUE(static_commands.find("") == static_commands.end());
+
+#if __cplusplus >= 201402L
+    uint8_t code = 0;
+    TEST_ASSERT_TRUE(static_commands_P.get_P(stop, code));
+    TEST_ASSERT_EQUAL(2, code);
+    TEST_ASSERT_FALSE(static_commands_P.get_P("stap", code));
+    TEST_ASSERT_TRUE(static_commands_P.exist_P("led"));
+#endif
+
+    arx::stdx::pair<uint16_t, uint16_t> registers[16] = {};
+    for (uint16_t i = 0; i < 16; ++i) registers[i] = {static_cast<uint16_t>(40001 + i * 3), i};
+    const arx::static_map<uint16_t, uint16_t, 16> by_address(registers);
+    TEST_ASSERT_TRUE(by_address.valid());
+    for (uint16_t i = 0; i < 16; ++i) TEST_ASSERT_EQUAL(i, by_address.value_or(40001 + i * 3, 0xFFFF));
+    TEST_ASSERT_FALSE(by_address.exist(40002));
+
+    const arx::static_map<int, int, 2> repeated({{7, 1}, {7, 2}});
+    TEST_ASSERT_FALSE(repeated.valid());
+    TEST_ASSERT_FALSE(repeated.exist(7));
+}
@@ -0,0 +1,43 @@
+#include <unity.h>
+#include "StaticTable.h"
+
+static ARX_CONSTEXPR14 arx::static_array<uint8_t, 256> make_crc8_table() {
+    arx::static_array<uint8_t, 256> table {};
+    for (size_t i = 0; i < 256; ++i) {
+        uint8_t crc = static_cast<uint8_t>(i);
+        for (int bit = 0; bit < 8; ++bit) crc = (crc & 0x80) ? static_cast<uint8_t>((crc << 1) ^ 0x07) : static_cast<uint8_t>(crc << 1);
+        table[i] = crc;
+    }
+    return table;
+}
+
+#if __cplusplus >= 201402L
+// built by the compiler
+static constexpr arx::static_array<uint8_t, 256> crc8_table = make_crc8_table();
+static_assert(crc8_table[1] == 0x07, "CRC table at compile time");
+
+static constexpr auto command_codes = arx::make_static_set({0x2A, 0x03, 0x1F, 0x03});
+static_assert(command_codes.size() == 3 && command_codes.exist(0x1F), "set sorted at compile time");
+#else
+static const arx::static_array<uint8_t, 256> crc8_table = make_crc8_table();
+static const arx::static_set<int, 4> command_codes = arx::make_static_set({0x2A, 0x03, 0x1F, 0x03});
+#endif
+
+void test_static_tables() {
+    TEST_ASSERT_EQUAL(0x07, crc8_table[1]);
+    TEST_ASSERT_EQUAL(0xF3, crc8_table[0xFF]);
+
+    TEST_ASSERT_EQUAL(3, command_codes.size());
+    TEST_ASSERT_EQUAL(0x03, command_codes[0]);
+    TEST_ASSERT_EQUAL(0x2A, command_codes[2]);
+    TEST_ASSERT_TRUE(command_codes.exist(0x2A));
+    TEST_ASSERT_FALSE(command_codes.exist(0x04));
+
+    // keys compare as strings, not as pointers
+    const arx::static_sorted_map<const char *, int, 3> commands({{"stop", 2}, {"start", 1}, {"reset", 3}});
+    const char start[] = "start";
+    TEST_ASSERT_EQUAL(1, commands.at(start));
+    TEST_ASSERT_EQUAL(0, commands.at("pause"));
+    TEST_ASSERT_EQUAL(7, commands.value_or("pause", 7));
+    TEST_ASSERT_EQUAL_STRING("reset", commands.begin()->first);
+}
@@ -0,0 +1,104 @@
+#include <unity.h>
+#include "ArxContainer.h"
+#include "TimerWheel.h"
+
+void test_timer_wheel_schedule_and_cancel() {
+    static int fired;
+    fired = 0;
+
+    ArxTimerWheel<4> wheel(1000);  // the global alias
+    auto a = wheel.schedule(10, []() { fired += 1; });
+    auto b = wheel.schedule(20, []() { fired += 10; });
+    TEST_ASSERT_TRUE(a.valid());
+    TEST_ASSERT_EQUAL(2, wheel.size());
+    TEST_ASSERT_EQUAL(10, wheel.remaining(a));
+
+    TEST_ASSERT_EQUAL(0, wheel.update(1009));
+    TEST_ASSERT_EQUAL(1, wheel.update(1010));
+    TEST_ASSERT_EQUAL(1, fired);
+    TEST_ASSERT_FALSE(wheel.pending(a));
+    TEST_ASSERT_FALSE(wheel.cancel(a));
+
+    TEST_ASSERT_TRUE(wheel.cancel(b));
+    TEST_ASSERT_FALSE(b.valid());
+    wheel.update(2000);
+    TEST_ASSERT_EQUAL(1, fired);
+    TEST_ASSERT_TRUE(wheel.empty());
+
+    for (int i = 0; i < 4; ++i) TEST_ASSERT_TRUE(wheel.schedule(5, []() {}).valid());
+    TEST_ASSERT_FALSE(wheel.schedule(5, []() {}).valid());
+    wheel.clear();
+    TEST_ASSERT_TRUE(wheel.empty());
+}
+
+void test_timer_wheel_fires_on_deadline() {
+    // delays across all levels, fired by single ticks and by large jumps
+    static const uint32_t delays[] = {1, 63, 64, 65, 100, 4095, 4096, 4097, 70000, 300000, 262143, 262144};
+    static const size_t COUNT = sizeof(delays) / sizeof(delays[0]);
+    static uint32_t fired_at[COUNT];
+    static arx::timer_wheel<COUNT> *wheel;
+
+    arx::timer_wheel<COUNT> w(0xFFFFF000UL);  // wraps the 32-bit tick counter on the way
+    wheel = &w;
+    const uint32_t start = w.now();
+    for (size_t i = 0; i < COUNT; ++i) {
+        fired_at[i] = 0;
+        w.schedule(delays[i], [i]() { fired_at[i] = wheel->now(); });
+    }
+
+    uint32_t now = start;
+    for (uint32_t t = 0; t < 5000; ++t) w.update(++now);
+    w.update(now += 100000);
+    w.update(now += 300000);
+
+    for (size_t i = 0; i < COUNT; ++i) TEST_ASSERT_EQUAL_UINT32(start + delays[i], fired_at[i]);
+    wheel = nullptr;  // w goes out of scope
+}
+
+void test_timer_wheel_reschedule_from_callback() {
+    static arx::timer_wheel<2> *wheel;
+    static int runs;
+    runs = 0;
+
+    arx::timer_wheel<2> w;
+    wheel = &w;
+    struct Periodic {
+        void operator()() const {
+            if (++runs < 5) wheel->schedule(100, Periodic());
+        }
+    };
+    w.schedule(100, Periodic());
+
+    for (uint32_t t = 1; t <= 1000; ++t) w.update(t);
+    TEST_ASSERT_EQUAL(5, runs);
+    TEST_ASSERT_TRUE(w.empty());
+    wheel = nullptr;  // w goes out of scope
+}
+
+void test_timer_wheel_rearm_on_full_wheel() {
+    // every node is in use: a firing timer's own node must be free again when it re-arms
+    static arx::timer_wheel<2> *wheel;
+    static int runs[2];
+    static int failed;
+    runs[0] = runs[1] = failed = 0;
+
+    arx::timer_wheel<2> w;
+    wheel = &w;
+    struct Periodic {
+        int id;
+
+        void operator()() const {
+            ++runs[id];
+            if (!wheel->schedule(10 + id, *this).valid()) ++failed;
+        }
+    };
+    TEST_ASSERT_TRUE(w.schedule(10, Periodic {0}).valid());
+    TEST_ASSERT_TRUE(w.schedule(11, Periodic {1}).valid());
+
+    for (uint32_t t = 1; t <= 110; ++t) w.update(t);
+    TEST_ASSERT_EQUAL(0, failed);
+    TEST_ASSERT_EQUAL(11, runs[0]);
+    TEST_ASSERT_EQUAL(10, runs[1]);
+    TEST_ASSERT_EQUAL(2, w.size());
+    wheel = nullptr;  // w goes out of scope
+}